@@ -4,7 +4,7 @@
 #include <Input.hpp>
 #include "Entity.hpp"
 #include "SpriteSheet.hpp"
-#include "SpriteAnimation.hpp"
+#include <AnimationLibrary.hpp>
 #include "TileManager.hpp"
 #include "../engine/dependencies/glfw/include/GLFW/glfw3.h"
 
@@ -19,13 +19,13 @@ private:
 
 	Texture2D texture;
 	SpriteSheet playerSS;
-	SpriteAnimation* currentAnim;
-	SpriteAnimation frontIdle;
-	SpriteAnimation rightIdle;
-	SpriteAnimation upIdle;
-	SpriteAnimation walkRight;
-	SpriteAnimation walkUp;
-	SpriteAnimation walkDown;
+	Animator animator;
+	uint32_t frontIdle;
+	uint32_t rightIdle;
+	uint32_t upIdle;
+	uint32_t walkRight;
+	uint32_t walkUp;
+	uint32_t walkDown;
 	Direction orientation;
 	bool walkLeft;
 	float colliderSize;
@@ -43,37 +43,43 @@ public:
 			.spacing = { 1, 1 },
 		};
 
-		frontIdle = SpriteAnimationParams{
+		frontIdle = AnimationLibrary::CreateClip({
+			.sheet = &playerSS,
 			.frames = {{0,2}, {1,2}},
 			.frameTime = 1.0f / 6.0f
-		};
+		});
 
-		rightIdle = SpriteAnimationParams{
+		rightIdle = AnimationLibrary::CreateClip({
+			.sheet = &playerSS,
 			.frames = {{0,1}, {1,1}},
 			.frameTime = 1.0f / 6.0f
-		};
+		});
 
-		upIdle = SpriteAnimationParams{
+		upIdle = AnimationLibrary::CreateClip({
+			.sheet = &playerSS,
 			.frames = {{0,0},{1,0}},
 			.frameTime = 1.0f / 6.0f
-		};
+		});
 
-		walkRight = SpriteAnimationParams{
+		walkRight = AnimationLibrary::CreateClip({
+			.sheet = &playerSS,
 			.frames = {{2,1}, {3,1}},
 			.frameTime = 1.0f/6.0f
-		};
+		});
 		
-		walkDown = SpriteAnimationParams{
+		walkDown = AnimationLibrary::CreateClip({
+			.sheet = &playerSS,
 			.frames = {{2,2}, {3,2}},
 			.frameTime = 1.0f / 6.0f
-		};
+		});
 
-		walkUp = SpriteAnimationParams{
+		walkUp = AnimationLibrary::CreateClip({
+			.sheet = &playerSS,
 			.frames = {{2,0}, {3,0}},
 			.frameTime = 1.0f / 6.0f
-		};
+		});
 
-		currentAnim = &frontIdle;
+		AnimationLibrary::Play(animator, frontIdle);
 		setDefaultValues();
 	}
 
@@ -89,99 +95,57 @@ public:
 	void handleInput() {
 
 		direction = { 0, 0 };
+		uint32_t clip = animator.Clip;
 		
 
 		if (Input::IsKeyPressed(GLFW_KEY_UP)) {
 			direction.y += 1;
-			currentAnim = &walkUp;
+			clip = walkUp;
 			orientation = Direction::UP;
 		}
 		if (Input::IsKeyPressed(GLFW_KEY_DOWN)) {
 			direction.y -= 1;
-			currentAnim = &walkDown;
+			clip = walkDown;
 			orientation = Direction::DOWN;
 		}
 		if (Input::IsKeyPressed(GLFW_KEY_LEFT)) {
 			direction.x -= 1;
-			currentAnim = &walkRight;
+			clip = walkRight;
 			orientation = Direction::LEFT;
 			walkLeft = true;
 			
 		}
 		if (Input::IsKeyPressed(GLFW_KEY_RIGHT)) {
 			direction.x += 1;
-			currentAnim = &walkRight;
+			clip = walkRight;
 			walkLeft = false;
 			orientation = Direction::RIGHT;
 		}
 
 		if (direction.x == 0 && direction.y == 0) {
 			switch (orientation) {
-				case Direction::DOWN:currentAnim = &frontIdle;break;
-				case Direction::UP:currentAnim = &upIdle;break;
-				case Direction::LEFT:currentAnim = &rightIdle;break;
-				case Direction::RIGHT:currentAnim = &rightIdle;break;
+				case Direction::DOWN:clip = frontIdle;break;
+				case Direction::UP:clip = upIdle;break;
+				case Direction::LEFT:clip = rightIdle;break;
+				case Direction::RIGHT:clip = rightIdle;break;
 			}
 		}
 
+		// Un solo Play por frame para no reiniciar el clip al pulsar dos teclas
+		AnimationLibrary::Play(animator, clip);
+
 		velocity = cass::Vector2<float>(direction).SafeNormalize() * speed;
 	}
 
 	void update(float deltaTime, TileManager &tileManager) {
-		const float EPS = 0.001f;
-		cass::Vector2<float> nextPosition = position;
-		nextPosition.x += velocity.x * deltaTime;
-		{
-			int left = (int)floor(nextPosition.x - halfCollider);
-			int right = (int)floor(nextPosition.x + halfCollider);
-			int bottom = (int)floor(position.y - halfCollider);
-			int top = (int)floor(position.y + halfCollider);
-			
-			for (int y = bottom; y <= top; y++) {
-				if (velocity.x > 0) {
-					if (tileManager.IsSolid(right, y)) {
-						nextPosition.x = right - halfCollider - EPS;
-						break;
-					}
-				}
-				else if (velocity.x < 0) {
-					if (tileManager.IsSolid(left, y)) {
-						nextPosition.x = left + 1 + halfCollider + EPS;
-						break;
-					}
-				}
-			}
-		}
+		cass::Vector2<float> half(halfCollider, halfCollider);
 
-		position.x = nextPosition.x;
-
-		nextPosition.y += velocity.y * deltaTime;
-
-		{
-			int left = (int)floor(position.x - halfCollider);
-			int right = (int)floor(position.x + halfCollider);
-			int bottom = (int)floor(nextPosition.y - halfCollider);
-			int top = (int)floor(nextPosition.y + halfCollider);
-
-			for (int x = left; x <= right; x++) {
-				if (velocity.y > 0) {
-					if (tileManager.IsSolid(x, top)) {
-						nextPosition.y = top - halfCollider - EPS;
-						break;
-					}
-				}
-				else if (velocity.y < 0) {
-					if (tileManager.IsSolid(x, bottom)) {
-						nextPosition.y = bottom + 1 + halfCollider + EPS;
-						break;
-					}
-				}
-			}
-		}
+		TileMoveResult move = tileManager.GetCollision().Move(
+			AABB::FromCenter(position, half), velocity * deltaTime);
 
-		position.y = nextPosition.y;
+		position = move.Bounds.GetCenter();
 
-		currentAnim->Update(deltaTime);
+		AnimationLibrary::Advance(&animator, 1, deltaTime);
 	}
 
 	void draw() {
@@ -189,9 +153,10 @@ public:
 			.position = position,
 			.size = {1,1},
 			.texture = &texture,
-			.uv = currentAnim->GetUV(playerSS),
+			.uv = AnimationLibrary::GetUV(animator),
 			.origin = {0.5,0.5},
 			.flipX = walkLeft,
+			.layer = 0.5f,   // delante de los tiles (capa 0)
 		});
 		/*
 		Renderer2D::DrawQuad({
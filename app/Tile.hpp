@@ -1,7 +1,8 @@
 #pragma once
 #include <memory>
+#include <PackedUV.hpp>
 
 struct Tile {
     bool collisionable = false;
-    cass::Vector4<float> uvs;
+    PackedUV uv;
 };
\ No newline at end of file
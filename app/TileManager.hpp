@@ -2,10 +2,13 @@
 #include "Tile.hpp"
 #include <memory>
 #include "Renderer2D.hpp"
+#include <TileGrid.hpp>
 #include <SpriteSheet.hpp>
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <cmath>
+#include <functional>
 
 class TileManager {
 public:
@@ -14,31 +17,32 @@ private:
     Tile tiles[32];
     SpriteSheet atlas;
     Texture2D atlasTexture;
-    
+    TileGrid collision;
+    std::vector<std::function<void(int, int)>> solidityListeners;
 
     void createTiles() { 
-        tiles[0] = Tile{ false, atlas.GetUV(4,1) }; 
-        tiles[1] = Tile{ true, atlas.GetUV(4,0)};
-        tiles[2] = Tile{ true, atlas.GetUV(3,0) };
-        tiles[3] = Tile{ true, atlas.GetUV(3,1) };
-        tiles[4] = Tile{ false, atlas.GetUV(3,2) };
-        tiles[5] = Tile{ true, atlas.GetUV(4,2) };
-        tiles[6] = Tile{ true, atlas.GetUV(0,3) };
-        tiles[7] = Tile{ true, atlas.GetUV(1,3) };
-        tiles[8] = Tile{ true, atlas.GetUV(2,3) };
-        tiles[9] = Tile{ false, atlas.GetUV(2,0) };
-        tiles[10] = Tile{ false, atlas.GetUV(1,0) };
-        tiles[11] = Tile{ false, atlas.GetUV(0,0) };
-        tiles[12] = Tile{ false, atlas.GetUV(0,1) };
-        tiles[13] = Tile{ false, atlas.GetUV(0,2) };
-        tiles[14] = Tile{ false, atlas.GetUV(1,2) };
-        tiles[15] = Tile{ false, atlas.GetUV(2,2) };
-        tiles[16] = Tile{ false, atlas.GetUV(2,1) };
-        tiles[17] = Tile{ false, atlas.GetUV(1,1) };
-        tiles[18] = Tile{ true, atlas.GetUV(3,3) };
-        tiles[19] = Tile{ true, atlas.GetUV(4,3) };
-        tiles[20] = Tile{ true, atlas.GetUV(4,4) };
-        tiles[21] = Tile{ true, atlas.GetUV(3,4) };
+        tiles[0] = Tile{ false, atlas.GetPackedUV(4,1) }; 
+        tiles[1] = Tile{ true, atlas.GetPackedUV(4,0)};
+        tiles[2] = Tile{ true, atlas.GetPackedUV(3,0) };
+        tiles[3] = Tile{ true, atlas.GetPackedUV(3,1) };
+        tiles[4] = Tile{ false, atlas.GetPackedUV(3,2) };
+        tiles[5] = Tile{ true, atlas.GetPackedUV(4,2) };
+        tiles[6] = Tile{ true, atlas.GetPackedUV(0,3) };
+        tiles[7] = Tile{ true, atlas.GetPackedUV(1,3) };
+        tiles[8] = Tile{ true, atlas.GetPackedUV(2,3) };
+        tiles[9] = Tile{ false, atlas.GetPackedUV(2,0) };
+        tiles[10] = Tile{ false, atlas.GetPackedUV(1,0) };
+        tiles[11] = Tile{ false, atlas.GetPackedUV(0,0) };
+        tiles[12] = Tile{ false, atlas.GetPackedUV(0,1) };
+        tiles[13] = Tile{ false, atlas.GetPackedUV(0,2) };
+        tiles[14] = Tile{ false, atlas.GetPackedUV(1,2) };
+        tiles[15] = Tile{ false, atlas.GetPackedUV(2,2) };
+        tiles[16] = Tile{ false, atlas.GetPackedUV(2,1) };
+        tiles[17] = Tile{ false, atlas.GetPackedUV(1,1) };
+        tiles[18] = Tile{ true, atlas.GetPackedUV(3,3) };
+        tiles[19] = Tile{ true, atlas.GetPackedUV(4,3) };
+        tiles[20] = Tile{ true, atlas.GetPackedUV(4,4) };
+        tiles[21] = Tile{ true, atlas.GetPackedUV(3,4) };
     }
 
     void readTileMap(const std::string& path) {
@@ -72,6 +76,24 @@ private:
         file.close();
     }
 
+    void buildCollision() {
+        uint32_t width = 0;
+        for (const auto& row : mapTile)
+            width = std::max(width, (uint32_t)row.size());
+
+        collision.Resize(width, (uint32_t)mapTile.size());
+
+        const int rows = (int)mapTile.size();
+        for (int i = 0; i < rows; i++) {
+            int y = rows - i - 1;
+            const int cols = (int)mapTile[i].size();
+            for (int j = 0; j < cols; j++)
+                collision.SetSolid(j, y, tiles[mapTile[i][j]].collisionable);
+        }
+
+        collision.EnableDistanceField();
+    }
+
 
 public:
     TileManager(std::string atlasTexturePath, std::string atlasMapPath) : atlasTexture(atlasTexturePath, {}) {
@@ -80,43 +102,78 @@ public:
             .textureHeight = (int)atlasTexture.GetHeight(),
             .spriteWidth = 16,
             .spriteHeight = 16,
-            .rows = 2,
-            .cols = 3
+            .rows = 8,
+            .cols = 8
             };
 
         createTiles();
         readTileMap(atlasMapPath);
+        buildCollision();
     }
-    void draw(cass::Vector3<float> cameraPosition, int screenCols, int screenRows) {
-        for (int i = 0; i < mapTile.size(); i++) {
-            for (int j = 0; j < mapTile[i].size(); j++) {
 
-                float y = mapTile.size() - i - 1;
+    const TileGrid& GetCollision() const { return collision; }
+    // Recorre solo las celdas que caen dentro del rectángulo visible de la escena actual
+    void draw() {
+        const cass::Vector4<float>& view = Renderer2D::GetVisibleRect();
+        const int rows = (int)mapTile.size();
+
+        // Fuera de una escena el rectángulo es ±FLT_MAX: se acota en float antes
+        // de pasar a int, que con un valor fuera de rango es UB
+        auto toCell = [](float v, int count) {
+            return (int)std::min((float)count, std::max(-1.0f, std::floor(v)));
+        };
 
-                if (j > cameraPosition.x + (screenCols/2 + 1) || j < cameraPosition.x - (screenCols / 2 + 1) ||
-                    y > cameraPosition.y + (screenRows/2 + 1) || y < cameraPosition.y - (screenRows / 2 + 1)) {
-                    continue;
-                }
+        int minY = std::max(0, toCell(view.y, rows));
+        int maxY = std::min(rows - 1, toCell(view.t, rows));
 
-                uint8_t tileID = mapTile[i][j];
+        for (int y = minY; y <= maxY; y++) {
+            const std::vector<uint8_t>& row = mapTile[rows - y - 1];
 
-                Renderer2D::DrawSprite({
-                    .position = cass::Vector2<float>(j, y),
-                    .size = {1,1},
+            const int cols = (int)row.size();
+            int minX = std::max(0, toCell(view.x, cols));
+            int maxX = std::min(cols - 1, toCell(view.z, cols));
+
+            for (int x = minX; x <= maxX; x++) {
+                Renderer2D::DrawTile({
+                    .position = cass::Vector2<float>(x, y),
                     .texture = &atlasTexture,
-                    .uv = tiles[tileID].uvs
+                    .uv = tiles[row[x]].uv
                     });
             }
         }
     }
 
-    bool IsSolid(int x, int y) {
-        int mapY = mapTile.size() - y - 1;
+    bool IsSolid(int x, int y) const {
+        return collision.IsSolid(x, y);
+    }
 
-        if (mapY < 0 || mapY >= mapTile.size()) return false;
-        if (x < 0 || x >= mapTile[mapY].size()) return false;
+    // Distancia en tiles al sólido más cercano (ver TileGrid::EnableDistanceField)
+    uint8_t GetClearance(int x, int y) const {
+        return collision.GetDistance(x, y);
+    }
+
+    // fn(x, y) tras cada SetTile que cambia la solidez de un tile. Quien navegue
+    // sobre GetCollision() tiene que registrarse aquí, p. ej.
+    // [&](int x, int y) { pathfinder.OnTileChanged(x, y); flowField.OnTileChanged(x, y); }
+    void AddSolidityListener(std::function<void(int, int)> fn) {
+        solidityListeners.push_back(std::move(fn));
+    }
+
+    void SetTile(int x, int y, uint8_t tileID) {
+        const int rows = (int)mapTile.size();
+        int mapY = rows - y - 1;
+
+        if (mapY < 0 || mapY >= rows) return;
+        if (x < 0 || x >= (int)mapTile[mapY].size()) return;
+
+        mapTile[mapY][x] = tileID;
+
+        bool solid = tiles[tileID].collisionable;
+        if (collision.IsSolid(x, y) == solid)
+            return;
 
-        uint8_t id = mapTile[mapY][x];
-        return tiles[id].collisionable;
+        collision.SetSolid(x, y, solid);
+        for (const auto& listener : solidityListeners)
+            listener(x, y);
     }
 };
\ No newline at end of file
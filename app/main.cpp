@@ -3,6 +3,7 @@
 #include "Player.hpp"
 #include "TileManager.hpp"
 #include <FontManager.hpp>
+#include <format>
 
 
 const int originalTileSize = 16;
@@ -30,8 +31,14 @@ private:
 
 	uint32_t arial24;
 
+	// Totales de las consultas de GPU del Renderer2D, para el resumen de una reproducción
+	uint64_t m_SamplesPassed = 0;
+	double m_GpuTimeMs = 0.0;
+	uint32_t m_GpuScenes = 0;
+	bool m_Layered;
+
 public:
-	SandBox(const WindowProperties& props) : 
+	SandBox(const WindowProperties& props, bool layered) : 
 		Application(props), 
 		m_Camera(
 			-(props.Width / static_cast<float>(tileSize)) * 0.5f,
@@ -41,32 +48,93 @@ public:
 		),
 		ui_Camera(0, props.Width,0, props.Height),
 		props(props),
-		tileManager("assets/atlas.png", "assets/level1.txt")
+		tileManager("assets/atlas.png", "assets/level1.txt"),
+		m_Layered(layered)
 	{
 		m_Camera.SetPosition({ player.position,0.0f });
 		Application::SetClearColor(0xFF000000);
 		FontManager::Init();
 		arial24 = FontManager::Load("assets/arial.ttf", 24);
+
+		// Tiles y personaje no se mezclan: lo opaco se dibuja con depth test y sin blending
+		Renderer2D::SetLayeredMode(layered);
+	}
+
+	// Overdraw y tiempo de GPU medios por frame; con --replay y con y sin --flat
+	// se compara el modo por capas contra el de siempre sobre la misma partida.
+	// Se divide por las escenas que llegaron a dar resultado (una por frame),
+	// no por los frames: las de los últimos frames no llegan a leerse
+	void printGpuSummary()
+	{
+		if (m_GpuScenes == 0)
+			return;
+
+		const double pixels = double(screenCols * originalTileSize * screenRows * originalTileSize);
+		const double samples = double(m_SamplesPassed) / m_GpuScenes;
+		std::cout << "Renderer2D " << (m_Layered ? "layered" : "flat") << ": "
+			<< std::format("{:.0f}", samples) << " samples/frame ("
+			<< std::format("{:.2f}x", samples / pixels) << " overdraw), "
+			<< std::format("{:.3f}", m_GpuTimeMs / m_GpuScenes) << " ms GPU/frame over "
+			<< m_GpuScenes << " frames\n";
 	}
 
 protected:
 	void OnUpdate(float deltaTime) override {
 
+		// F1 cambia el modo de depuración del Renderer2D; F2 imprime los flushes de este frame
+		if (Input::WasKeyPressed(GLFW_KEY_F1))
+			Renderer2D::SetDebugMode((Renderer2DDebugMode)(((int)Renderer2D::GetDebugMode() + 1) % 4));
+
 		player.handleInput();
 		player.update(deltaTime, tileManager);
 		v3 newCameraPosition = m_Camera.GetPosition() + (v3(player.position, 0.0f) - m_Camera.GetPosition()) * 0.1f;
 
 		m_Camera.SetPosition(newCameraPosition);
 
+		// El nivel se dibuja a la resolución del arte (16px por tile) y se escala x4
+		Renderer2D::BeginPixelPerfect({ .width = screenCols * originalTileSize, .height = screenRows * originalTileSize, .depth = true });
 		Renderer2D::BeginScene(m_Camera);
-		tileManager.draw(m_Camera.GetPosition(), screenCols, screenRows);
+		tileManager.draw();
 		player.draw();
+
+		// Texto translúcido en la misma capa que los tiles opacos: tiene que verse encima
+		Renderer2D::DrawText({
+			.font = arial24,
+			.text = "diablito",
+			.position = { player.position.x - 1.0f, player.position.y + 0.75f },
+			.scale = { 1.0f / 48.0f, 1.0f / 48.0f }
+			});
+
+		RenderSystems();
 		Renderer2D::EndScene();
+		Renderer2D::EndPixelPerfect();
+
+		if (Input::WasKeyPressed(GLFW_KEY_F2))
+			printFlushLog();
+
+		m_SamplesPassed += Renderer2D::GetStats().SamplesPassed;
+		m_GpuTimeMs += Renderer2D::GetStats().GpuTimeMs;
+		m_GpuScenes += Renderer2D::GetStats().GpuScenes;
 
 		showInfo(deltaTime);
 	}
 
 
+	float systemsMs()
+	{
+		float ms = 0.0f;
+		for (const SystemTiming& timing : GetScheduler().GetTimings())
+			ms += timing.Milliseconds;
+		return ms;
+	}
+
+	void printFlushLog()
+	{
+		for (const FlushRecord& flush : Renderer2D::GetFlushLog())
+			std::cout << Renderer2D::GetFlushReasonName(flush.Reason) << ": " << flush.QuadCount
+				<< " quads, " << flush.TextureCount << " textures\n";
+	}
+
 	void showInfo(float deltaTime)
 	{
 		m_TimeAccumulator += deltaTime;
@@ -80,7 +148,12 @@ protected:
 				"Sandbox | FPS: " + std::to_string(fps) +
 				" | Draw Calls: " + std::to_string(Renderer2D::GetStats().DrawCalls) +
 				" | Quads: " + std::to_string(Renderer2D::GetStats().QuadCount) +
-				" | TexturesSlots: " + std::to_string(Renderer2D::GetStats().TextureCount);
+				" | TexturesSlots: " + std::to_string(Renderer2D::GetStats().TextureCount) +
+				" | Culled: " + std::to_string(Renderer2D::GetStats().CulledQuads) +
+				" | Overdraw: " + std::format("{:.2f}x {:.2f} ms", Renderer2D::GetStats().SamplesPassed / float(screenCols * originalTileSize * screenRows * originalTileSize), Renderer2D::GetStats().GpuTimeMs) +
+				" | Fill: " + std::to_string(Renderer2D::GetStats().OffscreenPixels) + "/" + std::to_string(Renderer2D::GetStats().PresentedPixels) + " px" +
+				" | Systems: " + std::format("{:.2f} ms", systemsMs()) +
+				" | Frame: " + std::format("{:.2f} +/- {:.2f} ms", GetFramePacer().GetStats().AverageMs, GetFramePacer().GetStats().StdDevMs);
 
 
 			Application::m_Window->SetTitle(title);
@@ -91,7 +164,14 @@ protected:
 	}
 };
 
-int main() {
+// --record <archivo> graba la partida; --replay <archivo> la reproduce sin
+// ventana y a máxima velocidad e imprime los tiempos.
+// --fixed-step <hz> graba con dt fijo, para que la reproducción no dependa de la máquina.
+// --pace <fps> reproduce limitado por el FramePacer; comparar con y sin él da
+// la variación del tiempo de frame que quita el pacer.
+// --flat desactiva el modo por capas del Renderer2D; al final de una
+// reproducción se imprimen overdraw y tiempo de GPU para comparar los dos modos
+int main(int argc, char** argv) {
 
 	const int screenWidth = tileSize * screenCols;
 	const int screenHeight = tileSize * screenRows;
@@ -100,12 +180,44 @@ int main() {
 		.Width = screenWidth,
 		.Height = screenHeight,
 		.Title = "Hola cara de bola",
-		.VSync = true
+		.VSync = true,
+		.AdaptiveVSync = true
 	};
 
-	SandBox app(windowProps);
+	float fixedStep = 0.0f;
+	float pace = 0.0f;
+	bool layered = true;
+	std::string record;
+	std::string replay;
+
+	for (int i = 1; i < argc; i++) {
+		std::string option = argv[i];
+
+		if (option == "--flat")
+			layered = false;
+		else if (i + 1 >= argc)
+			break;
+		else if (option == "--fixed-step")
+			fixedStep = 1.0f / std::stof(argv[++i]);
+		else if (option == "--pace")
+			pace = std::stof(argv[++i]);
+		else if (option == "--record")
+			record = argv[++i];
+		else if (option == "--replay")
+			replay = argv[++i];
+	}
+
+	SandBox app(windowProps, layered);
+
+	if (!record.empty())
+		app.StartRecording(record, fixedStep);
+	if (!replay.empty())
+		app.StartReplay(replay, pace);
 
 	app.Run();
 
+	if (!replay.empty())
+		app.printGpuSummary();
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+#include <AnimationLibrary.hpp>
+#include <World.hpp>
+#include <Components.hpp>
+#include <Systems.hpp>
+#include "Bench.hpp"
+
+// Lo que había antes de AnimationLibrary: cada sprite con su propia copia de
+// los frames y un Update + GetUV por objeto
+class LegacySpriteAnimation {
+public:
+	LegacySpriteAnimation(const std::vector<cass::Vector2<int>>& frames, float frameTime)
+		: m_Frames(frames), m_FrameTime(frameTime) {
+	}
+
+	void Update(float dt) {
+		m_Timer += dt;
+		if (m_Timer >= m_FrameTime && !m_Frames.empty()) {
+			m_Timer -= m_FrameTime;
+			m_CurrentFrame = (m_CurrentFrame + 1) % m_Frames.size();
+		}
+	}
+
+	cass::Vector4<float> GetUV(const SpriteSheet& sheet) const {
+		const auto& frame = m_Frames[m_CurrentFrame];
+		return sheet.GetUV(frame.y, frame.x);
+	}
+
+private:
+	std::vector<cass::Vector2<int>> m_Frames;
+	float m_FrameTime = 0;
+	size_t m_CurrentFrame = 0;
+	float m_Timer = 0;
+};
+
+// 100k sprites animados con 8 clips distintos de 4-8 frames
+void AnimationBench()
+{
+	constexpr uint32_t Count = 100000;
+	constexpr uint32_t ClipCount = 8;
+	constexpr float Dt = 1.0f / 60.0f;
+
+	SpriteSheet sheet(SpriteSheetParams{
+		.textureWidth = 256, .textureHeight = 256,
+		.spriteWidth = 16, .spriteHeight = 16,
+		.rows = 16, .cols = 16
+		});
+
+	std::vector<std::vector<cass::Vector2<int>>> clipFrames(ClipCount);
+	std::vector<uint32_t> clips(ClipCount);
+	for (uint32_t c = 0; c < ClipCount; c++) {
+		for (uint32_t f = 0; f < 4 + c % 5; f++)
+			clipFrames[c].push_back({ (int)f, (int)c });
+		clips[c] = AnimationLibrary::CreateClip({ .sheet = &sheet, .frames = clipFrames[c], .frameTime = 0.08f + c * 0.01f });
+	}
+
+	std::mt19937 rng(5);
+	std::vector<uint32_t> clipOf(Count);
+	for (uint32_t& clip : clipOf)
+		clip = rng() % ClipCount;
+
+	std::vector<std::unique_ptr<LegacySpriteAnimation>> legacy;
+	std::vector<cass::Vector4<float>> legacyUVs(Count);
+	for (uint32_t i = 0; i < Count; i++)
+		legacy.push_back(std::make_unique<LegacySpriteAnimation>(clipFrames[clipOf[i]], 0.08f + clipOf[i] * 0.01f));
+
+	// Igual que en EcsBench: tras un rato de juego el vector no sigue el orden del heap
+	std::shuffle(legacy.begin(), legacy.end(), rng);
+
+	double legacyMs = MeasureMs([&] {
+		for (uint32_t i = 0; i < Count; i++) {
+			legacy[i]->Update(Dt);
+			legacyUVs[i] = legacy[i]->GetUV(sheet);
+		}
+	}, 30);
+
+	std::vector<Animator> animators(Count);
+	std::vector<Sprite> sprites(Count);
+	for (uint32_t i = 0; i < Count; i++)
+		animators[i] = { clips[clipOf[i]], 0, 0.0f };
+
+	double advanceMs = MeasureMs([&] {
+		AnimationLibrary::Advance(animators.data(), Count, Dt, &sprites[0].uv, sizeof(Sprite));
+	}, 30);
+
+	World world;
+	for (uint32_t i = 0; i < Count; i++)
+		world.Create(Animator{ clips[clipOf[i]], 0, 0.0f }, Sprite{});
+
+	double systemMs = MeasureMs([&] { SpriteAnimationSystem(world, Dt); }, 30);
+
+	Consume(legacyUVs.back().x + sprites.back().uv.x);
+
+	Report("100k: SpriteAnimation objects", legacyMs);
+	Report("100k: AnimationLibrary::Advance", advanceMs);
+	Report("100k: SpriteAnimationSystem (ECS)", systemMs);
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// Utilidades mínimas para los escenarios de bench/. Cada escenario es una
+// función void() registrada en main.cpp que imprime sus propias líneas.
+
+// Ejecuta fn `runs` veces y devuelve la mediana en ms
+template<typename Fn>
+double MeasureMs(Fn&& fn, int runs = 10)
+{
+	std::vector<double> samples;
+	samples.reserve(runs);
+
+	for (int i = 0; i < runs; i++) {
+		auto start = std::chrono::high_resolution_clock::now();
+		fn();
+		samples.push_back(std::chrono::duration<double, std::milli>(
+			std::chrono::high_resolution_clock::now() - start).count());
+	}
+
+	std::sort(samples.begin(), samples.end());
+	return samples[samples.size() / 2];
+}
+
+inline void Report(const char* label, double ms)
+{
+	std::printf("  %-40s %10.3f ms\n", label, ms);
+}
+
+// Evita que el optimizador descarte un resultado que no se usa
+template<typename T>
+inline void Consume(const T& value)
+{
+	volatile T sink = value;
+	(void)sink;
+}
+
+void EcsBench();
+void TextBench();
+void SpatialHashBench();
+void TileBench();
+void PathfinderBench();
+void AnimationBench();
+void PacingBench();
+void SkeletonBench();
+void StaticSpriteBench();
+void FontBench();
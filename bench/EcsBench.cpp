@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <World.hpp>
+#include <Components.hpp>
+#include <Systems.hpp>
+#include "../app/Entity.hpp"
+#include "Bench.hpp"
+
+// 100k entidades moviéndose: el World (chunks SoA, MovementSystem en paralelo)
+// contra un vector de Entity sueltas en el heap, como las tenía la app
+void EcsBench()
+{
+	constexpr uint32_t Count = 100000;
+	constexpr float Dt = 1.0f / 60.0f;
+
+	World world;
+	double createMs = MeasureMs([&] {
+		World scratch;
+		for (uint32_t i = 0; i < Count; i++)
+			scratch.Create(Position{ { (float)i, 0 } }, Velocity{ { 1, 2 } });
+	}, 3);
+
+	for (uint32_t i = 0; i < Count; i++)
+		world.Create(Position{ { (float)i, 0 } }, Velocity{ { 1, 2 } });
+
+	std::vector<std::unique_ptr<Entity>> entities;
+	for (uint32_t i = 0; i < Count; i++) {
+		auto entity = std::make_unique<Entity>();
+		entity->position = { (float)i, 0 };
+		entity->velocity = { 1, 2 };
+		entity->speed = 1;
+		entities.push_back(std::move(entity));
+	}
+
+	// Tras un rato de crear y destruir, el orden del vector ya no sigue al del heap
+	std::shuffle(entities.begin(), entities.end(), std::mt19937(42));
+
+	double heapMs = MeasureMs([&] {
+		for (auto& entity : entities) {
+			entity->position.x += entity->velocity.x * entity->speed * Dt;
+			entity->position.y += entity->velocity.y * entity->speed * Dt;
+		}
+	}, 50);
+
+	double chunkMs = MeasureMs([&] {
+		world.ForEachChunk<Position, Velocity>([](uint32_t count, EntityID*, Position* position, Velocity* velocity) {
+			for (uint32_t i = 0; i < count; i++) {
+				position[i].Value.x += velocity[i].Value.x * Dt;
+				position[i].Value.y += velocity[i].Value.y * Dt;
+			}
+		});
+	}, 50);
+
+	double systemMs = MeasureMs([&] { MovementSystem(world, Dt); }, 50);
+
+	float sum = 0;
+	world.Each<Position>([&sum](Position& position) { sum += position.Value.x; });
+	Consume(sum + entities.back()->position.x);
+
+	Report("create 100k (Position, Velocity)", createMs);
+	Report("move: heap Entity*", heapMs);
+	Report("move: ForEachChunk (1 hilo)", chunkMs);
+	Report("move: MovementSystem (JobSystem)", systemMs);
+}
@@ -0,0 +1,75 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <FontManager.hpp>
+#include "Bench.hpp"
+
+// Caché propia para no tocar la de la app; se borra al terminar
+static const char* BenchCacheDirectory = "bench_font_cache";
+
+static const uint32_t s_Sizes[] = { 12, 16, 24, 32, 48 };
+
+// Bytes de mapa de bits de los glifos ASCII y del atlas (R8) de las fuentes
+static void PrintBytes(const char* label, const std::vector<uint32_t>& fonts)
+{
+	size_t glyphBytes = 0, atlasBytes = 0;
+	for (uint32_t handle : fonts) {
+		Font* font = FontManager::Get(handle);
+		for (const FTGlyph& glyph : font->Glyphs)
+			glyphBytes += (size_t)glyph.Size.x * (size_t)glyph.Size.y;
+		atlasBytes += (size_t)font->atlas->GetWidth() * font->atlas->GetHeight();
+	}
+
+	std::printf("  %-40s glyphs %8.1f KB  atlas %8.1f KB\n", label, glyphBytes / 1024.0, atlasBytes / 1024.0);
+}
+
+// Carga de 5 tamaños de arial en bitmap y en SDF: en frío (sin caché en disco,
+// rasteriza con FreeType y escribe la caché) y en caliente (lee la caché).
+// Lo último es el arranque normal de la app a partir de la segunda ejecución.
+void FontBench()
+{
+	std::filesystem::remove_all(BenchCacheDirectory);
+	FontManager::SetCacheDirectory(BenchCacheDirectory);
+
+	for (FontRenderMode mode : { FontRenderMode::Bitmap, FontRenderMode::SDF }) {
+		FontParams params;
+		params.Mode = mode;
+		std::string name = mode == FontRenderMode::SDF ? "SDF" : "bitmap";
+		std::vector<uint32_t> fonts;
+
+		auto loadSizes = [&] {
+			fonts.clear();
+			for (uint32_t size : s_Sizes)
+				fonts.push_back(FontManager::Load("assets/arial.ttf", size, params));
+		};
+
+		// Vaciar el directorio cuesta poco al lado de rasterizar, se queda dentro
+		double coldMs = MeasureMs([&] {
+			std::filesystem::remove_all(BenchCacheDirectory);
+			loadSizes();
+		}, 3);
+		double warmMs = MeasureMs(loadSizes, 3);
+
+		Report((name + " x5 sizes: cold").c_str(), coldMs);
+		Report((name + " x5 sizes: warm").c_str(), warmMs);
+		PrintBytes((name + " x5 sizes").c_str(), fonts);
+	}
+
+	// Lo que pide una UI con SDF de verdad: un solo atlas a 48 px para todos los tamaños
+	FontParams sdf;
+	sdf.Mode = FontRenderMode::SDF;
+	std::vector<uint32_t> fonts;
+
+	double coldMs = MeasureMs([&] {
+		std::filesystem::remove_all(BenchCacheDirectory);
+		fonts = { FontManager::Load("assets/arial.ttf", 48, sdf) };
+	}, 3);
+	double warmMs = MeasureMs([&] { fonts = { FontManager::Load("assets/arial.ttf", 48, sdf) }; }, 3);
+
+	Report("SDF x1 atlas (48px): cold", coldMs);
+	Report("SDF x1 atlas (48px): warm", warmMs);
+	PrintBytes("SDF x1 atlas (48px)", fonts);
+
+	std::filesystem::remove_all(BenchCacheDirectory);
+	FontManager::SetCacheDirectory("cache");
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+#include <FramePacer.hpp>
+#include "Bench.hpp"
+
+using PacingClock = std::chrono::steady_clock;
+
+// Lo que se suele poner antes de un pacer: dormir hasta el siguiente frame
+class SleepLimiter {
+public:
+	explicit SleepLimiter(float framesPerSecond)
+		: m_FrameDuration(std::chrono::duration_cast<PacingClock::duration>(std::chrono::duration<double>(1.0 / framesPerSecond))),
+		m_NextFrame(PacingClock::now() + m_FrameDuration) {
+	}
+
+	void Wait() {
+		std::this_thread::sleep_until(m_NextFrame);
+		m_NextFrame = std::max(m_NextFrame + m_FrameDuration, PacingClock::now());
+	}
+
+private:
+	PacingClock::duration m_FrameDuration;
+	PacingClock::time_point m_NextFrame;
+};
+
+// Trabajo de CPU que no duerme, para que el frame no le ceda tiempo al limitador
+static void Spin(double ms)
+{
+	PacingClock::time_point end = PacingClock::now() + std::chrono::duration_cast<PacingClock::duration>(std::chrono::duration<double, std::milli>(ms));
+	while (PacingClock::now() < end);
+}
+
+// Corre `work.size()` frames con wait() al principio de cada uno (como Application::Run)
+// e imprime media, desviación y extremos del periodo entre frames
+template<typename Wait>
+static void MeasurePeriods(const char* label, const std::vector<double>& work, Wait&& wait)
+{
+	std::vector<double> periods;
+	periods.reserve(work.size());
+
+	PacingClock::time_point last{};
+	for (double ms : work) {
+		wait();
+
+		PacingClock::time_point now = PacingClock::now();
+		if (last != PacingClock::time_point{})
+			periods.push_back(std::chrono::duration<double, std::milli>(now - last).count());
+		last = now;
+
+		Spin(ms);
+	}
+
+	double sum = 0, sumSquares = 0;
+	for (double ms : periods) {
+		sum += ms;
+		sumSquares += ms * ms;
+	}
+
+	double mean = sum / periods.size();
+	double stdDev = std::sqrt(std::max(0.0, sumSquares / periods.size() - mean * mean));
+	std::sort(periods.begin(), periods.end());
+
+	std::printf("  %-28s avg %7.3f ms  stddev %6.3f ms  min %7.3f ms  p99 %7.3f ms  max %7.3f ms\n",
+		label, mean, stdDev, periods.front(), periods[periods.size() * 99 / 100], periods.back());
+}
+
+// 360 frames a 120 fps con 1-4 ms de trabajo variable por frame; la misma
+// secuencia de trabajo para los tres casos
+void PacingBench()
+{
+	constexpr float TargetFps = 120.0f;
+	constexpr uint32_t Frames = 360;
+
+	std::mt19937 rng(9);
+	std::uniform_real_distribution<double> workMs(1.0, 4.0);
+	std::vector<double> work(Frames);
+	for (double& ms : work)
+		ms = workMs(rng);
+
+	MeasurePeriods("no limiter", work, [] {});
+
+	SleepLimiter limiter(TargetFps);
+	MeasurePeriods("sleep_until limiter", work, [&] { limiter.Wait(); });
+
+	FramePacer pacer;
+	pacer.SetTargetFrameRate(TargetFps);
+	MeasurePeriods("FramePacer", work, [&] { pacer.Wait(); });
+}
@@ -0,0 +1,136 @@
+#include <cmath>
+#include <queue>
+#include <random>
+#include <vector>
+#include <Pathfinder.hpp>
+#include "Bench.hpp"
+
+using Tile = cass::Vector2<int>;
+
+// A* plano de 8 direcciones sin cortar esquinas: la referencia sin JPS ni HPA*
+static bool ReferenceAStar(const TileGrid& grid, Tile start, Tile goal)
+{
+	const int width = (int)grid.GetWidth();
+	const int height = (int)grid.GetHeight();
+	auto walkable = [&](int x, int y) { return x >= 0 && y >= 0 && x < width && y < height && !grid.IsSolid(x, y); };
+	auto heuristic = [&](int x, int y) {
+		int dx = std::abs(x - goal.x), dy = std::abs(y - goal.y);
+		return (float)std::max(dx, dy) + 0.41421356f * (float)std::min(dx, dy);
+	};
+
+	using Entry = std::pair<float, int>;
+	std::vector<float> cost((size_t)width * height, INFINITY);
+	std::vector<uint8_t> closed((size_t)width * height, 0);
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+	cost[(size_t)start.y * width + start.x] = 0;
+	open.push({ heuristic(start.x, start.y), start.y * width + start.x });
+
+	while (!open.empty()) {
+		int node = open.top().second;
+		open.pop();
+
+		if (closed[node])
+			continue;
+		closed[node] = 1;
+
+		int x = node % width, y = node / width;
+		if (x == goal.x && y == goal.y)
+			return true;
+
+		for (int dy = -1; dy <= 1; dy++) {
+			for (int dx = -1; dx <= 1; dx++) {
+				if ((!dx && !dy) || !walkable(x + dx, y + dy))
+					continue;
+				if (dx && dy && !(walkable(x + dx, y) && walkable(x, y + dy)))
+					continue;
+
+				int next = (y + dy) * width + x + dx;
+				float g = cost[node] + (dx && dy ? 1.41421356f : 1.0f);
+				if (g < cost[next]) {
+					cost[next] = g;
+					open.push({ g + heuristic(x + dx, y + dy), next });
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+// 2000 peticiones por frame sobre un mapa de 512x512 con un 20% de sólidos:
+// la mitad cortas (JPS), la mitad cruzando el mapa (HPA*)
+void PathfinderBench()
+{
+	constexpr int Size = 512;
+	constexpr uint32_t PerFrame = 2000;
+	constexpr int Frames = 5;
+
+	std::mt19937 rng(11);
+	TileGrid grid(Size, Size);
+	for (int y = 0; y < Size; y++) {
+		for (int x = 0; x < Size; x++)
+			grid.SetSolid(x, y, rng() % 100 < 20);
+	}
+
+	auto randomFree = [&] {
+		Tile tile;
+		do tile = Tile((int)(rng() % Size), (int)(rng() % Size)); while (grid.IsSolid(tile.x, tile.y));
+		return tile;
+	};
+
+	// Un juego de peticiones distinto por frame, para medir sin cache
+	std::vector<std::pair<Tile, Tile>> queries;
+	for (uint32_t i = 0; i < PerFrame * (Frames + 1); i++) {
+		Tile start = randomFree();
+		Tile goal = randomFree();
+		if (i % 2) {
+			do goal = Tile(std::clamp(start.x + (int)(rng() % 48) - 24, 0, Size - 1),
+				std::clamp(start.y + (int)(rng() % 48) - 24, 0, Size - 1));
+			while (grid.IsSolid(goal.x, goal.y));
+		}
+		queries.push_back({ start, goal });
+	}
+
+	std::unique_ptr<Pathfinder> pathfinder;
+	double buildMs = MeasureMs([&] { pathfinder = std::make_unique<Pathfinder>(grid); }, 3);
+
+	int frame = 0;
+	double coldMs = MeasureMs([&] {
+		const auto* batch = &queries[(size_t)PerFrame * frame++];
+		for (uint32_t i = 0; i < PerFrame; i++)
+			pathfinder->RequestPath(batch[i].first, batch[i].second);
+		pathfinder->ProcessRequests();
+	}, Frames);
+
+	// Las mismas peticiones del último frame: todas salen de la cache
+	double warmMs = MeasureMs([&] {
+		const auto* batch = &queries[(size_t)PerFrame * (Frames - 1)];
+		for (uint32_t i = 0; i < PerFrame; i++)
+			pathfinder->RequestPath(batch[i].first, batch[i].second);
+		pathfinder->ProcessRequests();
+	}, Frames);
+
+	std::vector<Tile> waypoints;
+	uint32_t found = 0;
+	double immediateMs = MeasureMs([&] {
+		Pathfinder fresh(grid);
+		const auto* batch = &queries[(size_t)PerFrame * Frames];
+		for (uint32_t i = 0; i < PerFrame; i++)
+			found += fresh.FindPath(batch[i].first, batch[i].second, waypoints);
+	}, 1) - buildMs;
+
+	uint32_t referenceFound = 0;
+	double referenceMs = MeasureMs([&] {
+		const auto* batch = &queries[(size_t)PerFrame * Frames];
+		for (uint32_t i = 0; i < PerFrame; i++)
+			referenceFound += ReferenceAStar(grid, batch[i].first, batch[i].second);
+	}, 1);
+
+	std::printf("  found: Pathfinder %u, A* %u (of %u)\n", found, referenceFound, PerFrame);
+	Report("build abstraction 512x512", buildMs);
+	Report("2000/frame: ProcessRequests, new", coldMs);
+	Report("2000/frame: ProcessRequests, cached", warmMs);
+	Report("2000/frame: FindPath one by one", immediateMs);
+	Report("2000/frame: plain A*", referenceMs);
+}
@@ -0,0 +1,115 @@
+#include <cmath>
+#include <string>
+#include <vector>
+#include <Renderer2D.hpp>
+#include <SkeletonLibrary.hpp>
+#include <World.hpp>
+#include <Components.hpp>
+#include <Systems.hpp>
+#include "Bench.hpp"
+
+// Personaje de 11 huesos (cadera, torso, cabeza, brazos y piernas de dos
+// huesos) con una pieza rígida por hueso. Con cape, además una capa de 4x6
+// quads deformada entre torso y cadera.
+static uint32_t CreateCharacter(bool cape)
+{
+	SkeletonParams params;
+	params.bones = {
+		{ -1, { { 0.0f, 0.0f } } },       // 0 cadera
+		{ 0, { { 0.0f, 0.3f } } },        // 1 torso
+		{ 1, { { 0.0f, 0.5f } } },        // 2 cabeza
+		{ 1, { { -0.25f, 0.4f } } },      // 3 brazo izquierdo
+		{ 3, { { 0.0f, -0.3f } } },       // 4 antebrazo izquierdo
+		{ 1, { { 0.25f, 0.4f } } },       // 5 brazo derecho
+		{ 5, { { 0.0f, -0.3f } } },       // 6 antebrazo derecho
+		{ 0, { { -0.12f, 0.0f } } },      // 7 muslo izquierdo
+		{ 7, { { 0.0f, -0.35f } } },      // 8 pierna izquierda
+		{ 0, { { 0.12f, 0.0f } } },       // 9 muslo derecho
+		{ 9, { { 0.0f, -0.35f } } },      // 10 pierna derecha
+	};
+
+	for (uint32_t bone = 0; bone < params.bones.size(); bone++) {
+		SkeletonPartParams part;
+		part.bone = bone;
+		part.size = { 0.2f, 0.35f };
+		part.origin = { 0.5f, 1.0f };
+		params.parts.push_back(part);
+	}
+
+	if (cape) {
+		SkeletonPartParams part;
+		part.bone = 1;
+		part.size = { 0.5f, 0.8f };
+		part.cols = 4;
+		part.rows = 6;
+		for (uint32_t r = 0; r <= part.rows; r++) {
+			float top = (float)r / part.rows;
+			for (uint32_t c = 0; c <= part.cols; c++)
+				part.weights.push_back({ { 0, 1 }, { 1.0f - top, top } });
+		}
+		params.parts.push_back(part);
+	}
+
+	return SkeletonLibrary::CreateSkeleton(params);
+}
+
+// Cada hueso oscila con un desfase distinto: 5 keyframes suaves en 1 s
+static uint32_t CreateWalk(uint32_t skeleton)
+{
+	SkeletonClipParams params;
+	params.duration = 1.0f;
+
+	for (uint32_t bone = 0; bone < SkeletonLibrary::GetBoneCount(skeleton); bone++) {
+		BoneTrackParams track;
+		track.bone = bone;
+		for (int k = 0; k <= 4; k++) {
+			BoneTransform transform = SkeletonLibrary::Sample(skeleton, 0, bone, 0.0f);
+			transform.Rotation = 0.4f * std::sin(k * 1.5707963f + bone);
+			track.keys.push_back({ .time = k * 0.25f, .transform = transform, .curve = Curve::Smooth });
+		}
+		params.tracks.push_back(track);
+	}
+
+	return SkeletonLibrary::CreateClip(skeleton, params);
+}
+
+// N personajes por frame a través de los sistemas del ECS: pose de mundo con
+// SkeletonAnimationSystem y envío de piezas con SkeletonRenderSystem
+void SkeletonBench()
+{
+	constexpr float Dt = 1.0f / 60.0f;
+	OrthographicCamera camera(-40.0f, 40.0f, -22.5f, 22.5f);
+
+	for (bool cape : { false, true }) {
+		uint32_t skeleton = CreateCharacter(cape);
+		uint32_t walk = CreateWalk(skeleton);
+
+		for (uint32_t count : { 500u, 2000u }) {
+			World world;
+			std::vector<SkeletonAnimator> animators;
+
+			for (uint32_t i = 0; i < count; i++) {
+				SkeletonAnimator animator = SkeletonLibrary::CreateAnimator(skeleton);
+				SkeletonLibrary::Play(animator, walk);
+				animator.Time = (i % 60) / 60.0f;
+				world.Create(Position{ { (float)(i % 80) - 40.0f, (float)(i / 80 % 45) - 22.5f } }, animator);
+				animators.push_back(animator);
+			}
+
+			double animateMs = MeasureMs([&] { SkeletonAnimationSystem(world, Dt); }, 30);
+
+			double drawMs = MeasureMs([&] {
+				Renderer2D::BeginScene(camera);
+				SkeletonRenderSystem(world);
+				Renderer2D::EndScene();
+			}, 30);
+
+			std::string label = std::to_string(count) + (cape ? " with cape" : " rigid");
+			Report((label + ": SkeletonAnimationSystem").c_str(), animateMs);
+			Report((label + ": SkeletonRenderSystem").c_str(), drawMs);
+
+			for (SkeletonAnimator& animator : animators)
+				SkeletonLibrary::DestroyAnimator(animator);
+		}
+	}
+}
@@ -0,0 +1,63 @@
+#include <random>
+#include <vector>
+#include <SpatialHash.hpp>
+#include "Bench.hpp"
+
+// 50k cuerpos repartidos por un mundo de 1000x1000: pares con el hash contra
+// comprobar todos contra todos
+void SpatialHashBench()
+{
+	constexpr uint32_t Count = 50000;
+
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<float> coord(0.0f, 1000.0f);
+	std::uniform_real_distribution<float> size(0.5f, 2.0f);
+	std::uniform_real_distribution<float> step(-0.2f, 0.2f);
+
+	std::vector<AABB> bodies(Count);
+	for (AABB& body : bodies) {
+		cass::Vector2<float> min(coord(rng), coord(rng));
+		float extent = size(rng);
+		body = { min, { min.x + extent, min.y + extent } };
+	}
+
+	SpatialHash hash({ .cellSize = 4.0f, .bucketCount = 65536 });
+	std::vector<uint32_t> proxies(Count);
+
+	double insertMs = MeasureMs([&] {
+		hash.Clear();
+		for (uint32_t i = 0; i < Count; i++)
+			proxies[i] = hash.Insert(bodies[i], i);
+	}, 3);
+
+	// Cada frame todos se mueven un poco
+	double moveMs = MeasureMs([&] {
+		for (uint32_t i = 0; i < Count; i++) {
+			cass::Vector2<float> delta(step(rng), step(rng));
+			bodies[i].Min = { bodies[i].Min.x + delta.x, bodies[i].Min.y + delta.y };
+			bodies[i].Max = { bodies[i].Max.x + delta.x, bodies[i].Max.y + delta.y };
+			hash.Move(proxies[i], bodies[i]);
+		}
+	});
+
+	std::vector<SpatialPair> pairs;
+	double pairsMs = MeasureMs([&] {
+		pairs.clear();
+		hash.ComputePairs(pairs);
+	});
+
+	size_t brutePairs = 0;
+	double bruteMs = MeasureMs([&] {
+		brutePairs = 0;
+		for (uint32_t a = 0; a < Count; a++) {
+			for (uint32_t b = a + 1; b < Count; b++)
+				brutePairs += bodies[a].Overlaps(bodies[b]);
+		}
+	}, 1);
+
+	std::printf("  pairs: hash %zu, brute force %zu\n", pairs.size(), brutePairs);
+	Report("insert 50k", insertMs);
+	Report("move 50k", moveMs);
+	Report("pairs: SpatialHash", pairsMs);
+	Report("pairs: O(n^2)", bruteMs);
+}
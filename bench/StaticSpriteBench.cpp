@@ -0,0 +1,126 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <Renderer2D.hpp>
+#include <StaticSpriteIndex.hpp>
+#include "Bench.hpp"
+
+// 1M props estáticos en un mundo de 2000x2000: construcción, consultas y Draw
+// de un área del tamaño de la pantalla (16x12), primero tal cual sale de Build
+// y después de un lote de ediciones que llena hojas y manda sprites a la lista aparte
+void StaticSpriteBench()
+{
+	constexpr uint32_t Count = 1000000;
+	constexpr uint32_t Areas = 1000;
+	constexpr float World = 2000.0f;
+
+	std::mt19937 rng(8);
+	std::uniform_real_distribution<float> coordinate(0.0f, World);
+
+	std::vector<cass::Vector2<float>> positions(Count);
+	std::vector<SpriteDrawData> sprites(Count);
+	for (uint32_t i = 0; i < Count; i++) {
+		positions[i] = { coordinate(rng), coordinate(rng) };
+		sprites[i].size = { 1.0f + (i % 3) * 0.5f, 1.0f + (i % 2) };
+	}
+
+	std::vector<AABB> areas(Areas);
+	std::uniform_real_distribution<float> corner(0.0f, World - 16.0f);
+	for (AABB& area : areas) {
+		cass::Vector2<float> min(corner(rng), corner(rng));
+		area = { min, min + cass::Vector2<float>(16.0f, 12.0f) };
+	}
+
+	// Copia de lo que hay en el índice por handle, para comprobar Query a fuerza bruta
+	std::vector<cass::Vector2<float>> livePositions = positions;
+	std::vector<SpriteDrawData> liveSprites = sprites;
+	std::vector<bool> alive(Count, true);
+
+	auto bounds = [&](uint32_t h) {
+		const SpriteDrawData& sprite = liveSprites[h];
+		cass::Vector2<float> min(livePositions[h].x - sprite.size.x * sprite.origin.x, livePositions[h].y - sprite.size.y * sprite.origin.y);
+		return AABB{ min, min + sprite.size };
+	};
+
+	StaticSpriteIndex index;
+	double buildMs = MeasureMs([&] { index.Build(positions.data(), sprites.data(), Count); }, 3);
+	Report("1M: Build", buildMs);
+
+	OrthographicCamera camera(0.0f, World, 0.0f, World);
+	std::vector<uint32_t> hits;
+
+	auto measure = [&](const std::string& label) {
+		size_t hitCount = 0;
+		double queryMs = MeasureMs([&] {
+			hitCount = 0;
+			for (const AABB& area : areas) {
+				hits.clear();
+				index.Query(area, hits);
+				hitCount += hits.size();
+			}
+		});
+
+		size_t drawn = 0;
+		double drawMs = MeasureMs([&] {
+			drawn = 0;
+			Renderer2D::BeginScene(camera);
+			for (const AABB& area : areas)
+				drawn += index.Draw(area);
+			Renderer2D::EndScene();
+		});
+
+		// La primera área contra fuerza bruta, para que el número no mienta
+		hits.clear();
+		index.Query(areas[0], hits);
+		size_t expected = 0;
+		for (uint32_t h = 0; h < alive.size(); h++)
+			expected += alive[h] && bounds(h).Overlaps(areas[0]);
+
+		std::printf("  %s: %zu hits and %zu sprites sent per area, overflow %u, check %s\n",
+			label.c_str(), hitCount / Areas, drawn / Areas, index.GetOverflowCount(),
+			hits.size() == expected ? "ok" : "MISMATCH");
+		Report((label + ": Query 16x12 x1000").c_str(), queryMs);
+		Report((label + ": Draw 16x12 x1000").c_str(), drawMs);
+	};
+
+	measure("built");
+
+	// 100k props nuevos en una esquina de 200x200 (llenan sus hojas), 50k
+	// movidos a cualquier parte y 50k quitados
+	std::uniform_real_distribution<float> cluster(0.0f, 200.0f);
+	std::uniform_int_distribution<uint32_t> handle(0, Count - 1);
+
+	double editMs = MeasureMs([&] {
+		for (uint32_t i = 0; i < 100000; i++) {
+			cass::Vector2<float> position(cluster(rng), cluster(rng));
+			uint32_t h = index.Insert(position, sprites[i]);
+			if (h >= alive.size()) {
+				livePositions.resize(h + 1);
+				liveSprites.resize(h + 1);
+				alive.resize(h + 1);
+			}
+			livePositions[h] = position;
+			liveSprites[h] = sprites[i];
+			alive[h] = true;
+		}
+		for (uint32_t i = 0; i < 50000; i++) {
+			uint32_t h = handle(rng);
+			if (!alive[h])
+				continue;
+			livePositions[h] = { coordinate(rng), coordinate(rng) };
+			index.Update(h, livePositions[h], liveSprites[h]);
+		}
+		for (uint32_t i = 0; i < 50000; i++) {
+			uint32_t h = handle(rng);
+			if (!alive[h])
+				continue;
+			index.Remove(h);
+			alive[h] = false;
+		}
+	}, 1);
+	Report("200k edits (insert/update/remove)", editMs);
+
+	// Un área dentro de la esquina editada, donde cae la lista aparte
+	areas[0] = { { 50.0f, 50.0f }, { 66.0f, 62.0f } };
+	measure("edited");
+}
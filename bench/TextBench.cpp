@@ -0,0 +1,64 @@
+#include <string>
+#include <vector>
+#include <Renderer2D.hpp>
+#include <FontManager.hpp>
+#include <TextLayout.hpp>
+#include "Bench.hpp"
+
+// 5000 etiquetas estáticas por frame: DrawText maqueta cada una en cada
+// llamada; DrawTextLayout reutiliza los quads de un TextLayout ya construido
+void TextBench()
+{
+	constexpr uint32_t Count = 5000;
+
+	uint32_t font = FontManager::Load("assets/arial.ttf", 24);
+	OrthographicCamera camera(0.0f, 1280.0f, 0.0f, 720.0f);
+
+	std::vector<std::string> texts;
+	std::vector<TextLayout> layouts;
+	std::vector<cass::Vector2<float>> positions;
+	texts.reserve(Count);
+	layouts.reserve(Count);
+
+	for (uint32_t i = 0; i < Count; i++) {
+		texts.push_back("Label " + std::to_string(i) + " (static)");
+		layouts.emplace_back(font, texts.back());
+		positions.push_back({ (float)(i % 50) * 25.0f, (float)(i / 50) * 7.0f });
+	}
+
+	// Maquetado solo, sin Renderer2D
+	Font* fontData = FontManager::Get(font);
+	std::vector<GlyphQuad> quads;
+	cass::Vector4<float> bounds;
+
+	double buildMs = MeasureMs([&] {
+		for (const std::string& text : texts)
+			TextLayout::Build(fontData, text, {}, quads, bounds);
+	});
+
+	double cachedMs = MeasureMs([&] {
+		size_t total = 0;
+		for (const TextLayout& layout : layouts)
+			total += layout.GetQuads().size();
+		Consume(total);
+	});
+
+	double drawTextMs = MeasureMs([&] {
+		Renderer2D::BeginScene(camera);
+		for (uint32_t i = 0; i < Count; i++)
+			Renderer2D::DrawText({ .font = font, .text = texts[i], .position = positions[i] });
+		Renderer2D::EndScene();
+	});
+
+	double drawLayoutMs = MeasureMs([&] {
+		Renderer2D::BeginScene(camera);
+		for (uint32_t i = 0; i < Count; i++)
+			Renderer2D::DrawTextLayout({ .layout = layouts[i], .position = positions[i] });
+		Renderer2D::EndScene();
+	});
+
+	Report("layout: TextLayout::Build x5000", buildMs);
+	Report("layout: cached TextLayout x5000", cachedMs);
+	Report("frame: DrawText x5000", drawTextMs);
+	Report("frame: DrawTextLayout x5000", drawLayoutMs);
+}
@@ -0,0 +1,200 @@
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <TileGrid.hpp>
+#include "Bench.hpp"
+
+// Lo que hacía Player::update antes de TileGrid::Move: mover un eje y luego el
+// otro, mirando solo los tiles de la posición final y empujando EPS fuera
+static cass::Vector2<float> ProbeMove(const TileGrid& grid, cass::Vector2<float> position, float half, const cass::Vector2<float>& delta)
+{
+	const float EPS = 0.001f;
+	cass::Vector2<float> next = position;
+
+	next.x += delta.x;
+	{
+		int left = (int)std::floor(next.x - half);
+		int right = (int)std::floor(next.x + half);
+		int bottom = (int)std::floor(position.y - half);
+		int top = (int)std::floor(position.y + half);
+
+		for (int y = bottom; y <= top; y++) {
+			if (delta.x > 0 && grid.IsSolid(right, y)) {
+				next.x = right - half - EPS;
+				break;
+			}
+			if (delta.x < 0 && grid.IsSolid(left, y)) {
+				next.x = left + 1 + half + EPS;
+				break;
+			}
+		}
+	}
+	position.x = next.x;
+
+	next.y += delta.y;
+	{
+		int left = (int)std::floor(position.x - half);
+		int right = (int)std::floor(position.x + half);
+		int bottom = (int)std::floor(next.y - half);
+		int top = (int)std::floor(next.y + half);
+
+		for (int x = left; x <= right; x++) {
+			if (delta.y > 0 && grid.IsSolid(x, top)) {
+				next.y = top - half - EPS;
+				break;
+			}
+			if (delta.y < 0 && grid.IsSolid(x, bottom)) {
+				next.y = bottom + 1 + half + EPS;
+				break;
+			}
+		}
+	}
+	position.y = next.y;
+
+	return position;
+}
+
+// Solapa la caja con algún sólido (tocar un borde no cuenta)
+static bool OverlapsSolid(const TileGrid& grid, const AABB& box)
+{
+	for (int y = (int)std::floor(box.Min.y); y < (int)std::ceil(box.Max.y); y++)
+		for (int x = (int)std::floor(box.Min.x); x < (int)std::ceil(box.Max.x); x++)
+			if (grid.IsSolid(x, y))
+				return true;
+	return false;
+}
+
+// 1M movimientos de una caja de 0.5 (la del jugador) en un mapa de 256x256 con
+// un 20% de sólidos: TileGrid::Move contra las sondas de antes con los mismos
+// deltas. Velocidad de jugador (hasta 0.25 tiles por frame) y de proyectil (hasta 4)
+static void MoveBench()
+{
+	constexpr int Size = 256;
+	constexpr uint32_t Moves = 1000000;
+	constexpr float Half = 0.25f;
+
+	std::mt19937 rng(4);
+	TileGrid grid(Size, Size);
+	for (int y = 0; y < Size; y++)
+		for (int x = 0; x < Size; x++)
+			grid.SetSolid(x, y, rng() % 5 == 0);
+
+	std::vector<cass::Vector2<float>> starts;
+	starts.reserve(Moves);
+	std::uniform_real_distribution<float> coordinate(1.0f, Size - 1.0f);
+	while (starts.size() < Moves) {
+		cass::Vector2<float> center(coordinate(rng), coordinate(rng));
+		if (!OverlapsSolid(grid, AABB::FromCenter(center, { Half, Half })))
+			starts.push_back(center);
+	}
+
+	for (float speed : { 0.25f, 4.0f }) {
+		std::uniform_real_distribution<float> component(-speed, speed);
+		std::vector<cass::Vector2<float>> deltas(Moves);
+		for (auto& delta : deltas)
+			delta = { component(rng), component(rng) };
+
+		std::vector<cass::Vector2<float>> probeEnd(Moves), moveEnd(Moves);
+
+		double probeMs = MeasureMs([&] {
+			for (uint32_t i = 0; i < Moves; i++)
+				probeEnd[i] = ProbeMove(grid, starts[i], Half, deltas[i]);
+		});
+
+		double moveMs = MeasureMs([&] {
+			for (uint32_t i = 0; i < Moves; i++)
+				moveEnd[i] = grid.Move(AABB::FromCenter(starts[i], { Half, Half }), deltas[i]).Bounds.GetCenter();
+		});
+
+		uint32_t probeOverlaps = 0, moveOverlaps = 0;
+		for (uint32_t i = 0; i < Moves; i++) {
+			probeOverlaps += OverlapsSolid(grid, AABB::FromCenter(probeEnd[i], { Half, Half }));
+			moveOverlaps += OverlapsSolid(grid, AABB::FromCenter(moveEnd[i], { Half, Half }));
+		}
+
+		std::string kind = speed < 1.0f ? "slow" : "fast";
+		std::printf("  %s: ending inside a solid: probes %u, Move %u\n", kind.c_str(), probeOverlaps, moveOverlaps);
+		Report((kind + " x1M: two-axis probes").c_str(), probeMs);
+		Report((kind + " x1M: TileGrid::Move").c_str(), moveMs);
+	}
+}
+
+// 4M consultas IsSolid sobre un mapa de 1024x1024: el camino que tenía
+// TileManager (mapTile[fila][x] -> tiles[id].collisionable) contra un bit del TileGrid
+void TileBench()
+{
+	constexpr int Size = 1024;
+	constexpr uint32_t Queries = 4000000;
+
+	std::mt19937 rng(3);
+	std::uniform_int_distribution<int> tileId(0, 21);
+
+	bool collisionable[32] = {};
+	for (int id = 1; id < 32; id += 2)
+		collisionable[id] = true;
+
+	std::vector<std::vector<uint8_t>> mapTile(Size, std::vector<uint8_t>(Size));
+	TileGrid grid(Size, Size);
+
+	for (int i = 0; i < Size; i++) {
+		int y = Size - i - 1;
+		for (int x = 0; x < Size; x++) {
+			mapTile[i][x] = (uint8_t)tileId(rng);
+			grid.SetSolid(x, y, collisionable[mapTile[i][x]]);
+		}
+	}
+
+	// Los personajes consultan alrededor de donde están: ráfagas cercanas entre sí.
+	// Las consultas dispersas (rayos largos, IA lejana) saltan por todo el mapa.
+	std::vector<cass::Vector2<int>> local(Queries), scattered(Queries);
+	std::uniform_int_distribution<int> center(0, Size - 1);
+	std::uniform_int_distribution<int> offset(-8, 8);
+	for (uint32_t i = 0; i < Queries; i += 64) {
+		int cx = center(rng), cy = center(rng);
+		for (uint32_t j = i; j < i + 64 && j < Queries; j++)
+			local[j] = { cx + offset(rng), cy + offset(rng) };
+	}
+	for (auto& p : scattered)
+		p = { center(rng), center(rng) };
+
+	auto mapSolid = [&](int x, int y) {
+		int mapY = Size - y - 1;
+		if (mapY < 0 || mapY >= Size || x < 0 || x >= Size)
+			return false;
+		return collisionable[mapTile[mapY][x]];
+	};
+
+	for (const auto* points : { &local, &scattered }) {
+		uint32_t mapHits = 0, gridHits = 0;
+
+		double mapMs = MeasureMs([&] {
+			mapHits = 0;
+			for (const auto& p : *points)
+				mapHits += mapSolid(p.x, p.y);
+		});
+
+		double gridMs = MeasureMs([&] {
+			gridHits = 0;
+			for (const auto& p : *points)
+				gridHits += grid.IsSolid(p.x, p.y);
+		});
+
+		std::string kind = points == &local ? "local" : "scattered";
+		std::printf("  %s: solid hits map %u, grid %u\n", kind.c_str(), mapHits, gridHits);
+		Report((kind + " IsSolid x4M: mapTile + tiles[]").c_str(), mapMs);
+		Report((kind + " IsSolid x4M: TileGrid").c_str(), gridMs);
+	}
+
+	grid.EnableDistanceField();
+	double distanceMs = MeasureMs([&] {
+		uint32_t sum = 0;
+		for (const auto& p : local)
+			sum += grid.GetDistance(p.x, p.y);
+		Consume(sum);
+	});
+
+	Report("local GetDistance x4M: TileGrid", distanceMs);
+
+	MoveBench();
+}
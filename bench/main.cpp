@@ -0,0 +1,73 @@
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <JobSystem.hpp>
+#include <Window.hpp>
+#include <Renderer.hpp>
+#include <Renderer2D.hpp>
+#include <FontManager.hpp>
+#include "Bench.hpp"
+
+// bench [escenario...]: sin argumentos corre todos
+struct Scenario {
+	const char* Name;
+	void (*Run)();
+	bool NeedsRenderer = false;   // abre una ventana oculta con contexto GL antes de correr
+};
+
+static const Scenario s_Scenarios[] = {
+	{ "ecs", EcsBench },
+	{ "text", TextBench, true },
+	{ "spatialhash", SpatialHashBench },
+	{ "tiles", TileBench },
+	{ "pathfinder", PathfinderBench },
+	{ "animation", AnimationBench },
+	{ "pacing", PacingBench },
+	{ "skeleton", SkeletonBench, true },
+	{ "staticsprites", StaticSpriteBench, true },
+	{ "fonts", FontBench, true },
+};
+
+static std::unique_ptr<Window> s_Window;
+
+static void InitRenderer()
+{
+	if (s_Window)
+		return;
+
+	s_Window = std::make_unique<Window>(WindowProperties{ .Width = 1280, .Height = 720, .Title = "bench" });
+	s_Window->SetVisible(false);
+
+	Renderer::Init();
+	Renderer2D::Init();
+	FontManager::Init();
+}
+
+int main(int argc, char** argv)
+{
+	JobSystem::Init();
+
+	for (const Scenario& scenario : s_Scenarios) {
+		bool selected = argc < 2;
+		for (int i = 1; i < argc; i++)
+			selected |= std::strcmp(argv[i], scenario.Name) == 0;
+
+		if (!selected)
+			continue;
+
+		if (scenario.NeedsRenderer)
+			InitRenderer();
+
+		std::cout << "[" << scenario.Name << "]" << std::endl;
+		scenario.Run();
+	}
+
+	if (s_Window) {
+		FontManager::Shutdown();
+		Renderer2D::ShutDown();
+		s_Window.reset();
+	}
+
+	JobSystem::Shutdown();
+	return 0;
+}
@@ -2,7 +2,6 @@
 #include <Input.hpp>
 #include <GLFW/glfw3.h>
 #include <Application.hpp>
-#include <MouseScrolledEvent .hpp>
 
 cass::Vector2<float> CameraController::ScreenToWorld(const cass::Vector2<float>& screen, float width, float height)
 {
@@ -85,13 +84,11 @@ void CameraController::HandleInputUpdate(float deltaTime, float width, float hei
 
 void CameraController::HandleInputEvent(Event& e)
 {
-	if (e.GetType() == EventType::MouseScrolled)
+	if (e.Type == EventType::MouseScrolled)
 	{
-		auto& scroll = (MouseScrolledEvent&)e;
-
 		float zoom = m_Camera.GetZoom();
 
-		zoom -= scroll.GetYOffset() * 0.1f;
+		zoom -= e.MouseScrolled.YOffset * 0.1f;
 
 		if (zoom < 0.1f) zoom = 0.1f;
 		if (zoom > 1.5f) zoom = 1.5f;
@@ -1,14 +1,15 @@
 #include <Application.hpp>
 #include <Renderer2D.hpp>
 #include <FontManager.hpp>
-#include <KeyEvent.hpp>
 #include <GLFW/glfw3.h>
 #include <Input.hpp>
-#include <WindowResizeEvent .hpp>
-#include <MouseScrolledEvent .hpp>
 #include "CameraController.hpp"
 #include <SpriteSheet.hpp>
-#include <MousePressedEvent.hpp>
+#include <TextLayout.hpp>
+#include <Framebuffer.hpp>
+#include <Renderer.hpp>
+#include <format>
+#include <iterator>
 
 using v3 = cass::Vector3<float>;
 
@@ -34,6 +35,8 @@ private:
 	bool hasSelection = false;
 
 	uint32_t arial24;
+	std::string coordsBuffer;
+	TextLayout coordsLayout;
 	std::vector<std::vector<uint8_t>> mapTile;
 	Texture2D atlasTexture;
 	SpriteSheet ss;
@@ -55,6 +58,7 @@ public:
 		FontManager::Init();
 
 		arial24 = FontManager::Load("assets/arial.ttf", 24);
+		coordsLayout = TextLayout(arial24, "");
 
 		ss = SpriteSheetParams{
 			.textureWidth = (int)atlasTexture.GetWidth(),
@@ -70,8 +74,16 @@ protected:
 
 	void OnUpdate(float deltaTime) override {
 
-		cameraController.HandleInputUpdate(deltaTime, Application::GetWindow().GetWidth(), Application::GetWindow().GetHeight());
-		
+		// La escena se dibuja en su propio framebuffer del tamaño del viewport (a la izquierda del panel)
+		uint32_t viewWidth = getViewportWidth();
+		uint32_t viewHeight = std::max(Application::GetWindow().GetHeight(), 1u);
+
+		cameraController.HandleInputUpdate(deltaTime, viewWidth, viewHeight);
+
+		Framebuffer* viewport = RenderTargetPool::Acquire({ .Width = viewWidth, .Height = viewHeight });
+		viewport->Bind();
+		Renderer::Clear(0xFF121212);
+
 		Renderer2D::BeginScene(m_Camera);
 
 		DrawGridInfinite(16.0f,0xFF555555,1.0f);
@@ -87,13 +99,29 @@ protected:
 			.argb = 0x80FFFFFF,
 			.origin = {0,0},
 		});
+		RenderSystems();
 		Renderer2D::EndScene();
+		viewport->Unbind();
 
 		Renderer2D::BeginScene(ui_Camera); 
 
-		Renderer2D::DrawText({
-			.font = arial24,
-			.text = "Screen: " + Input::GetMousePosition().toString() + " | World: "  + cameraController.getWorldMouse().toString(),
+		Renderer2D::DrawSprite({
+			.position = { 0, 0 },
+			.size = { (float)viewWidth, (float)viewHeight },
+			.texture = viewport->GetColorAttachment()
+		});
+
+		// El buffer reutiliza su capacidad y el layout solo se rehace si el texto cambia
+		cass::Vector2<float> screen = Input::GetMousePosition();
+		cass::Vector2<float> world = cameraController.getWorldMouse();
+
+		coordsBuffer.clear();
+		std::format_to(std::back_inserter(coordsBuffer),
+			"Screen: ({}, {}) | World: ({}, {})", screen.x, screen.y, world.x, world.y);
+		coordsLayout.SetText(coordsBuffer);
+
+		Renderer2D::DrawTextLayout({
+			.layout = coordsLayout,
 			.position = { 50, 50},
 			.scale = { 1.0f, 1.0f }
 		});
@@ -147,18 +175,20 @@ protected:
 		}
 
 		Renderer2D::EndScene();
+		RenderTargetPool::Release(viewport);
 
 		showInfo(deltaTime);
 	}
 
 	void OnEvent(Event& e) override
 	{
-		if (e.GetType() == EventType::WindowResize) {
-			auto& resize = (WindowResizeEvent&)e;
+		if (e.Type == EventType::WindowResize) {
+			const WindowResizeEventData& resize = e.WindowResize;
+			float viewWidth = (float)getViewportWidth();
 
 			m_Camera.SetProjection(
-				-resize.Width * 0.5f,
-				resize.Width * 0.5f,
+				-viewWidth * 0.5f,
+				viewWidth * 0.5f,
 				-resize.Height * 0.5f,
 				resize.Height * 0.5f
 			);
@@ -169,10 +199,8 @@ protected:
 		cameraController.HandleInputEvent(e);
 
 
-		if (e.GetType() == EventType::MousePressed) {
-			auto& mouse = (MousePressedEvent&)e;
-
-			if (mouse.GetButton() == GLFW_MOUSE_BUTTON_LEFT) {
+		if (e.Type == EventType::MousePressed) {
+			if (e.MouseButton.Button == GLFW_MOUSE_BUTTON_LEFT) {
 				auto mousePos = Input::GetMousePosition();
 
 				if (mousePos.x >= getStartX()) {
@@ -203,7 +231,7 @@ protected:
 		cass::Vector3<float> camPos = m_Camera.GetPosition();
 		float zoom = m_Camera.GetZoom();
 
-		float viewWidth = Application::GetWindow().GetWidth() * zoom;
+		float viewWidth = getViewportWidth() * zoom;
 		float viewHeight = Application::GetWindow().GetHeight() * zoom;
 
 		float left = camPos.x - viewWidth * 0.5f;
@@ -261,6 +289,10 @@ protected:
 	float getStartX() {
 		return Application::GetWindow().GetWidth() - panelWidth;
 	}
+
+	uint32_t getViewportWidth() {
+		return (uint32_t)std::max(getStartX(), 1.0f);
+	}
 };
 
 int main() {
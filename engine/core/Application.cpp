@@ -2,6 +2,17 @@
 #include "Renderer.hpp"
 #include "Time.hpp"
 #include <Renderer2D.hpp>
+#include <Framebuffer.hpp>
+#include <FontManager.hpp>
+#include <JobSystem.hpp>
+#include <Profiler.hpp>
+#include <climits>
+#include <Input.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <map>
 
 Application* Application::s_Instance = nullptr;
 
@@ -9,37 +20,227 @@ Application::Application(const WindowProperties& props)
 {
     s_Instance = this;
     m_Window = new Window(props);
-    m_Window->SetEventCallback(
-        [this](Event& e) {
-            this->OnEvent(e);
-        }
-    );
+    Input::Init(m_Window->GetNativeWindow());
+    m_FramePacer.SetTargetFrameRate(props.MaxFrameRate);
+
+    m_EventDispatcher.PushLayer({
+        .Handler = [](void* app, Event& e) {
+            ((Application*)app)->OnEvent(e);
+            return e.Handled;
+        },
+        .Context = this,
+        .Priority = INT_MIN
+        });
 
     deltaTime = 0;
+    JobSystem::Init();
     Renderer::Init();
     Renderer2D::Init();
 }
 
 Application::~Application()
 {
+    RenderTargetPool::Clear();
+    JobSystem::Shutdown();
     delete m_Window;
 }
 
+// Tiempos de una reproducción: duración de cada frame, periodo entre frames
+// (lo que regula el FramePacer) y total de cada scope del profiler
+struct ReplaySummary {
+    std::vector<float> FrameMs;
+    std::vector<float> PeriodMs;
+    std::map<std::string, float> ScopeMs;
+    std::map<std::string, float> SystemMs;
+
+    void AddScopes(const std::vector<ProfileSample>& samples) {
+        for (const ProfileSample& sample : samples)
+            ScopeMs[sample.Name] += sample.Milliseconds;
+    }
+
+    void AddSystems(const std::vector<SystemTiming>& timings) {
+        for (const SystemTiming& timing : timings)
+            SystemMs[timing.Name] += timing.Milliseconds;
+    }
+
+    void Print() {
+        if (FrameMs.empty())
+            return;
+
+        float total = 0;
+        for (float ms : FrameMs)
+            total += ms;
+
+        std::vector<float> sorted = FrameMs;
+        std::sort(sorted.begin(), sorted.end());
+        size_t count = sorted.size();
+
+        std::cout << "Replay: " << count << " frames in " << total << " ms\n";
+        std::cout << "  frame avg " << total / count << " ms, p50 " << sorted[count / 2]
+            << " ms, p99 " << sorted[std::min(count - 1, count * 99 / 100)]
+            << " ms, max " << sorted.back() << " ms\n";
+
+        if (!PeriodMs.empty()) {
+            double sum = 0, sumSquares = 0;
+            for (float ms : PeriodMs) {
+                sum += ms;
+                sumSquares += (double)ms * ms;
+            }
+
+            double mean = sum / PeriodMs.size();
+            double stdDev = std::sqrt(std::max(0.0, sumSquares / PeriodMs.size() - mean * mean));
+            auto [minMs, maxMs] = std::minmax_element(PeriodMs.begin(), PeriodMs.end());
+
+            std::cout << "  period avg " << mean << " ms, stddev " << stdDev
+                << " ms, min " << *minMs << " ms, max " << *maxMs << " ms\n";
+        }
+
+        std::vector<std::pair<std::string, float>> scopes(ScopeMs.begin(), ScopeMs.end());
+        std::sort(scopes.begin(), scopes.end(),
+            [](const auto& a, const auto& b) { return a.second > b.second; });
+
+        for (const auto& [name, ms] : scopes)
+            std::cout << "  " << name << ": " << ms / count << " ms/frame\n";
+
+        if (!SystemMs.empty()) {
+            std::cout << "  systems:\n";
+            for (const auto& [name, ms] : SystemMs)
+                std::cout << "    " << name << ": " << ms / count << " ms/frame\n";
+        }
+    }
+};
+
+bool Application::StartRecording(const std::string& path, float fixedDeltaTime)
+{
+    m_RecordDeltaTime = fixedDeltaTime;
+    return m_Recorder.Begin(path);
+}
+
+void Application::StopRecording()
+{
+    m_Recorder.End();
+}
+
+bool Application::StartReplay(const std::string& path, float frameRate)
+{
+    if (!m_Replay.Open(path))
+        return false;
+
+    m_Window->SetVisible(false);
+    m_Window->SetVSync(false);
+    m_FramePacer.SetTargetFrameRate(frameRate);
+    return true;
+}
+
 void Application::Run()
 {
+    ReplaySummary summary;
+    std::chrono::high_resolution_clock::time_point lastFrameStart{};
+
     m_Window->DispatchInitialResize();
     while (!m_Window->ShouldClose())
     {
-        deltaTime = Time::GetDeltaTime();
+        // Esperar antes de leer la entrada: el frame se construye con la más reciente
+        m_FramePacer.Wait();
+
+        auto frameStart = std::chrono::high_resolution_clock::now();
+        if (m_Replay.IsOpen() && lastFrameStart != std::chrono::high_resolution_clock::time_point{})
+            summary.PeriodMs.push_back(std::chrono::duration<float, std::milli>(frameStart - lastFrameStart).count());
+        lastFrameStart = frameStart;
+
+        m_Window->PollEvents();
+
+        if (m_Replay.IsOpen()) {
+            InputSnapshot snapshot;
+            if (!m_Replay.Next(snapshot, deltaTime))
+                break;
+            Input::SetSnapshot(snapshot);
+        }
+        else {
+            deltaTime = Time::GetDeltaTime();
+
+            // Con paso fijo la partida grabada avanza exactamente como se reproducirá
+            if (m_Recorder.IsRecording() && m_RecordDeltaTime > 0.0f)
+                deltaTime = m_RecordDeltaTime;
+        }
+
+        ProcessEvents();
+        m_Recorder.Record(Input::GetSnapshot(), deltaTime);
+        FontManager::NewFrame();
+        RenderTargetPool::NewFrame();
+        Profiler::BeginFrame();
 
         Renderer::BeginFrame();
         Renderer2D::ResetStats();
+        m_Scheduler.Run(deltaTime, SystemPhase::Update);
+
+        m_SystemsRendered = false;
         OnUpdate(deltaTime);
+
+        static bool warned = false;
+        if (!m_SystemsRendered && !warned && m_Scheduler.HasSystems(SystemPhase::Render)) {
+            std::cerr << "Render systems are registered but OnUpdate never calls RenderSystems()\n";
+            warned = true;
+        }
+
         Renderer::EndFrame();
-        m_Window->Update();
+        m_Window->SwapBuffers();
+
+        if (m_Replay.IsOpen()) {
+            summary.FrameMs.push_back(std::chrono::duration<float, std::milli>(
+                std::chrono::high_resolution_clock::now() - frameStart).count());
+            summary.AddScopes(Profiler::GetLastFrame());
+            summary.AddSystems(m_Scheduler.GetTimings());
+        }
+    }
+
+    if (m_Replay.IsOpen()) {
+        Profiler::BeginFrame();
+        summary.AddScopes(Profiler::GetLastFrame());
+        summary.Print();
     }
 }
 
+void Application::RenderSystems()
+{
+    m_Scheduler.Run(deltaTime, SystemPhase::Render);
+    m_SystemsRendered = true;
+}
+
+void Application::ProcessEvents()
+{
+    // Durante una reproducción la entrada viene de la grabación: de la
+    // ventana solo pasan los eventos que no son de entrada, y los de entrada
+    // se reconstruyen a partir de la instantánea reproducida
+    const bool replaying = m_Replay.IsOpen();
+
+    m_FrameEvents.clear();
+
+    Event e;
+    while (m_Window->GetEvents().Pop(e)) {
+        if (replaying) {
+            if (e.Type != EventType::WindowResize && e.Type != EventType::WindowClose)
+                continue;
+        }
+        else {
+            Input::OnEvent(e);
+        }
+
+        m_FrameEvents.push_back(e);
+    }
+
+    if (replaying)
+        InputReplay::SynthesizeEvents(Input::GetSnapshot(), m_FrameEvents);
+
+    // La instantánea se publica antes de repartir: dentro de OnEvent, Input ya
+    // tiene el estado de todo el frame (el evento trae el dato exacto del momento)
+    if (!replaying)
+        Input::NewFrame();
+
+    for (Event& event : m_FrameEvents)
+        m_EventDispatcher.Dispatch(event);
+}
+
 void Application::SetClearColor(const uint32_t argb)
 {
     Renderer::SetClearColor(argb);
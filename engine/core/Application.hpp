@@ -1,6 +1,10 @@
 #pragma once
 #include <Window.hpp>
-#include <Event.hpp>
+#include <EventDispatcher.hpp>
+#include <World.hpp>
+#include <SystemScheduler.hpp>
+#include <InputRecorder.hpp>
+#include <FramePacer.hpp>
 
 class Application {
 private:
@@ -14,10 +18,43 @@ public:
 	
 	inline static Application& Get() { return *s_Instance; }
 	inline Window& GetWindow() { return *m_Window; }
+	inline World& GetWorld() { return m_World; }
+	// Los sistemas de Update corren cada frame justo antes de OnUpdate; los de
+	// Render, cuando OnUpdate llama a RenderSystems()
+	inline SystemScheduler& GetScheduler() { return m_Scheduler; }
+	// OnEvent es la capa más baja; las capas con Priority > 0 reciben antes
+	inline EventDispatcher& GetEventDispatcher() { return m_EventDispatcher; }
+	inline FramePacer& GetFramePacer() { return m_FramePacer; }
+
+	// Guarda la entrada y el dt de cada frame para reproducirlos luego.
+	// fixedDeltaTime > 0 hace que la partida avance con ese dt mientras se graba
+	// (y así se guarda), en vez del tiempo real de cada frame
+	bool StartRecording(const std::string& path, float fixedDeltaTime = 0.0f);
+	void StopRecording();
+	// Run() reproduce la grabación con la ventana oculta y sin VSync y al
+	// terminar imprime un resumen de tiempos. Con frameRate = 0 va lo más rápido
+	// posible; con frameRate > 0 el FramePacer lo limita, y el resumen muestra
+	// la variación del periodo entre frames con y sin él
+	bool StartReplay(const std::string& path, float frameRate = 0.0f);
 
 protected:
 	void SetClearColor(const uint32_t argb);
+	// Vacía la cola de eventos de la ventana y los reparte por las capas
+	void ProcessEvents();
 	virtual void OnEvent(Event& e) {}
 	virtual void OnUpdate(float deltaTime){}
+	// Ejecuta los sistemas de Render; llamar desde OnUpdate entre BeginScene y EndScene
+	void RenderSystems();
     Window* m_Window;
+	World m_World;
+	SystemScheduler m_Scheduler{ m_World };
+	EventDispatcher m_EventDispatcher;
+	FramePacer m_FramePacer;
+
+private:
+	bool m_SystemsRendered = false;
+	float m_RecordDeltaTime = 0.0f;
+	std::vector<Event> m_FrameEvents;
+	InputRecorder m_Recorder;
+	InputReplay m_Replay;
 };
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+void FramePacer::SetTargetFrameRate(float framesPerSecond)
+{
+	m_TargetFps = framesPerSecond > 0 ? framesPerSecond : 0;
+	m_FrameDuration = m_TargetFps > 0
+		? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_TargetFps))
+		: Clock::duration{};
+	m_NextFrame = Clock::now() + m_FrameDuration;
+}
+
+void FramePacer::Wait()
+{
+	if (m_TargetFps > 0) {
+		Clock::time_point now = Clock::now();
+
+		// Si el frame llegó tarde no se intenta recuperar con uno más corto:
+		// se reancla al instante actual
+		if (now >= m_NextFrame) {
+			m_NextFrame = now + m_FrameDuration;
+		}
+		else {
+			Clock::time_point wake = m_NextFrame - m_SpinMargin;
+
+			if (now < wake) {
+				std::this_thread::sleep_for(wake - now);
+
+				// Si sleep_for se pasó, la próxima vez se despierta antes,
+				// y si va sobrado el margen baja poco a poco
+				Clock::duration late = Clock::now() - wake;
+				if (late > m_SpinMargin)
+					m_SpinMargin = std::min<Clock::duration>(late, std::chrono::milliseconds(4));
+				else if (late < m_SpinMargin / 2)
+					m_SpinMargin = std::max<Clock::duration>(m_SpinMargin - std::chrono::microseconds(10), std::chrono::microseconds(500));
+			}
+
+			while (Clock::now() < m_NextFrame)
+				std::this_thread::yield();
+
+			m_NextFrame += m_FrameDuration;
+		}
+	}
+
+	Clock::time_point now = Clock::now();
+	if (m_LastFrame != Clock::time_point{})
+		UpdateStats(std::chrono::duration<float, std::milli>(now - m_LastFrame).count());
+	m_LastFrame = now;
+}
+
+void FramePacer::UpdateStats(float frameMs)
+{
+	if (m_Count == 0) {
+		m_Min = frameMs;
+		m_Max = frameMs;
+	}
+
+	m_Sum += frameMs;
+	m_SumSquares += (double)frameMs * frameMs;
+	m_Min = std::min(m_Min, frameMs);
+	m_Max = std::max(m_Max, frameMs);
+
+	if (++m_Count < StatsWindow)
+		return;
+
+	double mean = m_Sum / m_Count;
+	m_Stats.AverageMs = (float)mean;
+	m_Stats.StdDevMs = (float)std::sqrt(std::max(0.0, m_SumSquares / m_Count - mean * mean));
+	m_Stats.MinMs = m_Min;
+	m_Stats.MaxMs = m_Max;
+
+	m_Sum = m_SumSquares = 0;
+	m_Count = 0;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+struct FramePacerStats {
+	float AverageMs = 0;
+	float StdDevMs = 0;     // variación entre frames: lo que se nota como tirones
+	float MinMs = 0;
+	float MaxMs = 0;
+};
+
+// Limita el frame rate durmiendo casi todo el tiempo que sobra y esperando
+// activamente solo el último tramo, que es donde sleep_for no es preciso.
+// Se llama a Wait() al principio del frame, antes de leer la entrada, para
+// que lo que se dibuja use la entrada más reciente posible (late latch).
+class FramePacer {
+public:
+	void SetTargetFrameRate(float framesPerSecond);   // 0 = sin límite
+	float GetTargetFrameRate() const { return m_TargetFps; }
+
+	void Wait();
+
+	// Estadísticas de la duración de frame (de Wait a Wait) en la última ventana de StatsWindow frames
+	const FramePacerStats& GetStats() const { return m_Stats; }
+
+private:
+	using Clock = std::chrono::steady_clock;
+	static constexpr uint32_t StatsWindow = 120;
+
+	void UpdateStats(float frameMs);
+
+	float m_TargetFps = 0;
+	Clock::duration m_FrameDuration{};
+	Clock::time_point m_NextFrame{};
+	Clock::time_point m_LastFrame{};
+
+	// Margen para despertar antes del objetivo: crece con lo que se ha pasado sleep_for
+	Clock::duration m_SpinMargin = std::chrono::microseconds(1500);
+
+	FramePacerStats m_Stats;
+	double m_Sum = 0;
+	double m_SumSquares = 0;
+	float m_Min = 0;
+	float m_Max = 0;
+	uint32_t m_Count = 0;
+};
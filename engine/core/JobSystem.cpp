@@ -0,0 +1,166 @@
+#include "JobSystem.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+struct Job {
+	std::function<void()> Function;
+	JobCounter* Counter = nullptr;
+};
+
+struct JobSystemData {
+	std::vector<std::thread> Workers;
+	std::deque<Job> Queue;
+	std::mutex Mutex;
+	std::condition_variable WorkAvailable;
+	std::condition_variable JobFinished;
+	bool Running = false;
+};
+
+static JobSystemData s_Jobs;
+
+void JobSystem::Init(uint32_t workerCount)
+{
+	if (s_Jobs.Running)
+		return;
+
+	if (workerCount == 0) {
+		uint32_t cores = std::thread::hardware_concurrency();
+		workerCount = cores > 1 ? cores - 1 : 1;
+	}
+
+	s_Jobs.Running = true;
+
+	for (uint32_t i = 0; i < workerCount; i++)
+		s_Jobs.Workers.emplace_back(WorkerLoop);
+}
+
+void JobSystem::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(s_Jobs.Mutex);
+		s_Jobs.Running = false;
+	}
+
+	s_Jobs.WorkAvailable.notify_all();
+
+	for (std::thread& worker : s_Jobs.Workers)
+		worker.join();
+
+	s_Jobs.Workers.clear();
+	s_Jobs.Queue.clear();
+}
+
+uint32_t JobSystem::GetWorkerCount()
+{
+	return (uint32_t)s_Jobs.Workers.size();
+}
+
+void JobSystem::Execute(std::function<void()> job, JobCounter* counter)
+{
+	if (counter)
+		counter->Pending.fetch_add(1, std::memory_order_relaxed);
+
+	// Sin hilos (Init no llamado) se ejecuta en el acto
+	if (s_Jobs.Workers.empty()) {
+		job();
+		if (counter)
+			counter->Pending.fetch_sub(1, std::memory_order_release);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(s_Jobs.Mutex);
+		s_Jobs.Queue.push_back({ std::move(job), counter });
+	}
+
+	s_Jobs.WorkAvailable.notify_one();
+}
+
+bool JobSystem::RunPendingJob()
+{
+	Job job;
+
+	{
+		std::lock_guard<std::mutex> lock(s_Jobs.Mutex);
+		if (s_Jobs.Queue.empty())
+			return false;
+
+		job = std::move(s_Jobs.Queue.front());
+		s_Jobs.Queue.pop_front();
+	}
+
+	job.Function();
+
+	if (job.Counter)
+	{
+		// Se avisa bajo el mutex para que Wait() no pierda la notificación
+		std::lock_guard<std::mutex> lock(s_Jobs.Mutex);
+		job.Counter->Pending.fetch_sub(1, std::memory_order_release);
+	}
+
+	s_Jobs.JobFinished.notify_all();
+	return true;
+}
+
+void JobSystem::WorkerLoop()
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(s_Jobs.Mutex);
+			s_Jobs.WorkAvailable.wait(lock, [] {
+				return !s_Jobs.Queue.empty() || !s_Jobs.Running;
+			});
+
+			if (!s_Jobs.Running && s_Jobs.Queue.empty())
+				return;
+		}
+
+		RunPendingJob();
+	}
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+	while (counter.Pending.load(std::memory_order_acquire) > 0)
+	{
+		if (RunPendingJob())
+			continue;
+
+		std::unique_lock<std::mutex> lock(s_Jobs.Mutex);
+		s_Jobs.JobFinished.wait(lock, [&counter] {
+			return counter.Pending.load(std::memory_order_acquire) == 0 || !s_Jobs.Queue.empty();
+		});
+	}
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize,
+	const std::function<void(uint32_t, uint32_t)>& fn)
+{
+	if (count == 0)
+		return;
+
+	batchSize = std::max(batchSize, 1u);
+
+	if (count <= batchSize || s_Jobs.Workers.empty()) {
+		fn(0, count);
+		return;
+	}
+
+	JobCounter counter;
+
+	for (uint32_t begin = batchSize; begin < count; begin += batchSize)
+	{
+		uint32_t end = std::min(begin + batchSize, count);
+		Execute([&fn, begin, end] { fn(begin, end); }, &counter);
+	}
+
+	// El primer lote lo hace el hilo que llama
+	fn(0, std::min(batchSize, count));
+
+	Wait(counter);
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+// Contador de trabajos pendientes: Wait() vuelve cuando llega a cero
+struct JobCounter {
+	std::atomic<uint32_t> Pending{ 0 };
+};
+
+// Pool de hilos con una cola compartida. El hilo que espera un contador
+// también ejecuta trabajos, así que Wait() nunca deja un núcleo ocioso.
+class JobSystem {
+public:
+	static void Init(uint32_t workerCount = 0);   // 0 = núcleos - 1
+	static void Shutdown();
+
+	static void Execute(std::function<void()> job, JobCounter* counter = nullptr);
+
+	// Divide [0, count) en lotes de batchSize y llama fn(begin, end) en paralelo
+	static void ParallelFor(uint32_t count, uint32_t batchSize,
+		const std::function<void(uint32_t, uint32_t)>& fn);
+
+	static void Wait(JobCounter& counter);
+
+	static uint32_t GetWorkerCount();
+
+	// Ejecuta un trabajo de la cola en el hilo actual; false si estaba vacía
+	static bool RunPendingJob();
+
+private:
+	static void WorkerLoop();
+};
@@ -0,0 +1,24 @@
+#include "Profiler.hpp"
+#include <mutex>
+
+static std::mutex s_ProfilerMutex;
+static std::vector<ProfileSample> s_CurrentFrame;
+static std::vector<ProfileSample> s_LastFrame;
+
+void Profiler::BeginFrame()
+{
+	std::lock_guard<std::mutex> lock(s_ProfilerMutex);
+	s_LastFrame.swap(s_CurrentFrame);
+	s_CurrentFrame.clear();
+}
+
+void Profiler::Record(const char* name, float milliseconds)
+{
+	std::lock_guard<std::mutex> lock(s_ProfilerMutex);
+	s_CurrentFrame.push_back({ name, milliseconds });
+}
+
+const std::vector<ProfileSample>& Profiler::GetLastFrame()
+{
+	return s_LastFrame;
+}
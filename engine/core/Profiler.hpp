@@ -0,0 +1,37 @@
+#pragma once
+#include <vector>
+#include <chrono>
+
+struct ProfileSample {
+	const char* Name;      // literal: el profiler no copia el nombre
+	float Milliseconds;
+};
+
+// Tiempos con nombre por frame. Se puede registrar desde cualquier hilo;
+// GetLastFrame() devuelve lo del frame anterior completo.
+class Profiler {
+public:
+	static void BeginFrame();
+	static void Record(const char* name, float milliseconds);
+	static const std::vector<ProfileSample>& GetLastFrame();
+};
+
+class ProfileScope {
+public:
+	ProfileScope(const char* name)
+		: m_Name(name), m_Start(std::chrono::high_resolution_clock::now()) {
+	}
+
+	~ProfileScope() {
+		Profiler::Record(m_Name, std::chrono::duration<float, std::milli>(
+			std::chrono::high_resolution_clock::now() - m_Start).count());
+	}
+
+private:
+	const char* m_Name;
+	std::chrono::high_resolution_clock::time_point m_Start;
+};
+
+#define CASS_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CASS_PROFILE_CONCAT(a, b) CASS_PROFILE_CONCAT_IMPL(a, b)
+#define CASS_PROFILE_SCOPE(name) ProfileScope CASS_PROFILE_CONCAT(profileScope, __LINE__)(name)
@@ -2,10 +2,6 @@
 #include <GLFW/glfw3.h>
 #include <iostream>
 #include "Window.hpp"
-#include <KeyEvent.hpp>
-#include <WindowResizeEvent .hpp>
-#include <MouseScrolledEvent .hpp>
-#include <MousePressedEvent.hpp>
 
 Window::Window(const WindowProperties& props)
 {
@@ -21,7 +17,6 @@ void Window::Init(const WindowProperties& props)
 {
     m_Width = props.Width;
     m_Height = props.Height;
-    m_VSync = props.VSync;
     m_Title = props.Title;
 
     if (!glfwInit())
@@ -88,7 +83,7 @@ void Window::Init(const WindowProperties& props)
         return;
     }
 
-    SetVSync(m_VSync);
+    SetVSyncMode(!props.VSync ? VSyncMode::Off : props.AdaptiveVSync ? VSyncMode::Adaptive : VSyncMode::On);
 
     glViewport(0, 0, m_Width, m_Height);
 
@@ -97,14 +92,10 @@ void Window::Init(const WindowProperties& props)
 
             Window* win = (Window*)glfwGetWindowUserPointer(window);
 
-            if (action == GLFW_PRESS) {
-                KeyPressedEvent e(key);
-                win->m_EventCallback(e);
-            }
-            else if (action == GLFW_RELEASE) {
-                KeyReleasedEvent e(key);
-                win->m_EventCallback(e);
-            }
+            if (action == GLFW_PRESS)
+                win->m_Events.Push(Event::KeyPressed(key, mods));
+            else if (action == GLFW_RELEASE)
+                win->m_Events.Push(Event::KeyReleased(key, mods));
         });
 
     glfwSetMouseButtonCallback((GLFWwindow*)m_Window, [](GLFWwindow* window, int button, int action, int mods)
@@ -112,10 +103,16 @@ void Window::Init(const WindowProperties& props)
             Window* win = (Window*)glfwGetWindowUserPointer(window);
 
             if (action == GLFW_PRESS)
-            {
-                MousePressedEvent e(button);
-                win->m_EventCallback(e);
-            }
+                win->m_Events.Push(Event::MousePressed(button, mods));
+            else if (action == GLFW_RELEASE)
+                win->m_Events.Push(Event::MouseReleased(button, mods));
+        });
+
+    glfwSetCursorPosCallback((GLFWwindow*)m_Window,
+        [](GLFWwindow* window, double x, double y)
+        {
+            Window* win = (Window*)glfwGetWindowUserPointer(window);
+            win->m_Events.Push(Event::MouseMove((float)x, (float)y));
         });
 
     glfwSetFramebufferSizeCallback((GLFWwindow*)m_Window,
@@ -129,17 +126,21 @@ void Window::Init(const WindowProperties& props)
 
             glViewport(0, 0, width, height);
 
-            WindowResizeEvent e(width, height);
-            win->m_EventCallback(e);
+            win->m_Events.Push(Event::Resize(width, height));
         });
 
     glfwSetScrollCallback((GLFWwindow*)m_Window,
     [](GLFWwindow* win, double xOffset, double yOffset)
     {
         Window* window = (Window*)glfwGetWindowUserPointer(win);
+        window->m_Events.Push(Event::MouseScroll((float)xOffset, (float)yOffset));
+    });
 
-        MouseScrolledEvent e((float)xOffset, (float)yOffset);
-        window->m_EventCallback(e);
+    glfwSetWindowCloseCallback((GLFWwindow*)m_Window,
+    [](GLFWwindow* win)
+    {
+        Window* window = (Window*)glfwGetWindowUserPointer(win);
+        window->m_Events.Push(Event::Close());
     });
 
     std::cout << "Renderer: " << glGetString(GL_RENDERER) << "\n";
@@ -153,8 +154,18 @@ void Window::Shutdown()
 }
 
 void Window::Update()
+{
+    SwapBuffers();
+    PollEvents();
+}
+
+void Window::SwapBuffers()
 {
     glfwSwapBuffers((GLFWwindow*)m_Window);
+}
+
+void Window::PollEvents()
+{
     glfwPollEvents();
 }
 
@@ -204,8 +215,30 @@ void Window::ToggleFullscreen()
 
 void Window::SetVSync(bool enabled)
 {
-    glfwSwapInterval(enabled ? 1 : 0);
-    m_VSync = enabled;
+    SetVSyncMode(enabled ? VSyncMode::On : VSyncMode::Off);
+}
+
+void Window::SetVSyncMode(VSyncMode mode)
+{
+    if (mode == VSyncMode::Adaptive &&
+        !glfwExtensionSupported("WGL_EXT_swap_control_tear") &&
+        !glfwExtensionSupported("GLX_EXT_swap_control_tear"))
+    {
+        std::cout << "Adaptive VSync not supported, using VSync\n";
+        mode = VSyncMode::On;
+    }
+
+    // Un intervalo negativo es el swap_control_tear: espera al vblank solo si llega a tiempo
+    glfwSwapInterval(mode == VSyncMode::Adaptive ? -1 : mode == VSyncMode::On ? 1 : 0);
+    m_VSyncMode = mode;
+}
+
+void Window::SetVisible(bool visible)
+{
+    if (visible)
+        glfwShowWindow((GLFWwindow*)m_Window);
+    else
+        glfwHideWindow((GLFWwindow*)m_Window);
 }
 
 bool Window::ShouldClose() const
@@ -224,6 +257,5 @@ void Window::DispatchInitialResize()
     int width, height;
     glfwGetFramebufferSize((GLFWwindow*)m_Window, &width, &height);
     glViewport(0, 0, width, height);
-    WindowResizeEvent e(width, height);
-    m_EventCallback(e);
+    m_Events.Push(Event::Resize(width, height));
 }
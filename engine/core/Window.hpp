@@ -1,13 +1,20 @@
 #pragma once
 #include <string>
-#include <functional>
-#include <Event.hpp>
+#include <EventQueue.hpp>
+
+enum class VSyncMode {
+    Off,
+    On,
+    Adaptive    // como On, pero un frame que llega tarde se presenta ya en vez de esperar al siguiente vblank
+};
 
 struct WindowProperties {
     unsigned int Width = 1280;
     unsigned int Height = 1280;
     std::string Title = "Application";
     bool VSync = false;
+    bool AdaptiveVSync = false;   // con VSync; si el driver no lo admite se queda en On
+    float MaxFrameRate = 0.0f;    // 0 = sin límite (ver FramePacer)
 
     bool Fullscreen = false;
     bool Resizable = true;
@@ -21,16 +28,18 @@ class Window
 {
 public:
 
-    using EventCallbackFn = std::function<void(Event&)>;
-
-    void SetEventCallback(const EventCallbackFn& callback) {
-        m_EventCallback = callback;
-    }
+    // Los callbacks de GLFW encolan aquí durante glfwPollEvents (en Update);
+    // la aplicación los vacía en un punto fijo del frame
+    using Events = EventQueue<1024>;
 
     Window(const WindowProperties& props);
     ~Window();
 
+    // Update = SwapBuffers + PollEvents. Application los llama por separado
+    // para leer la entrada justo antes de empezar el frame.
     void Update();
+    void SwapBuffers();
+    void PollEvents();
 
     unsigned int GetWidth() const { return m_Width; }
     unsigned int GetHeight() const { return m_Height; }
@@ -38,10 +47,14 @@ public:
     void ToggleFullscreen();
 
     void SetVSync(bool enabled);
+    void SetVSyncMode(VSyncMode mode);
+    VSyncMode GetVSyncMode() const { return m_VSyncMode; }
+    void SetVisible(bool visible);
     void SetTitle(const std::string& title);
-    bool IsVSync() const { return m_VSync; }
+    bool IsVSync() const { return m_VSyncMode != VSyncMode::Off; }
 
     void* GetNativeWindow() const { return m_Window; } // GLFWwindow*
+    Events& GetEvents() { return m_Events; }
     void DispatchInitialResize();
     bool ShouldClose() const;
 
@@ -50,12 +63,12 @@ private:
     void Shutdown();
 
 private:
-    EventCallbackFn m_EventCallback;
+    Events m_Events;
     void* m_Window; // GLFWwindow*
     unsigned int m_Width, m_Height;
     int m_WindowWidth, m_WindowHeight;
     std::string m_Title;
-    bool m_VSync;
+    VSyncMode m_VSyncMode = VSyncMode::Off;
     bool m_Fullscreen = false;
     int m_WindowPosX, m_WindowPosY;
 };
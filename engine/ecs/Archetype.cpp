@@ -0,0 +1,102 @@
+#include "Archetype.hpp"
+#include <cstring>
+#include <new>
+#include <algorithm>
+
+void Chunk::Deleter::operator()(uint8_t* data) const
+{
+	::operator delete(data, std::align_val_t(Archetype::ChunkAlign));
+}
+
+static uint32_t AlignUp(uint32_t value, uint32_t align)
+{
+	return (value + align - 1) & ~(align - 1);
+}
+
+Archetype::Archetype(ComponentMask mask)
+	: m_Mask(mask)
+{
+	uint32_t rowBytes = sizeof(EntityID);
+
+	for (ComponentID id = 0; id < MaxComponents; id++)
+	{
+		if ((mask >> id) & 1)
+		{
+			m_Components.push_back(id);
+			rowBytes += ComponentRegistry::Info(id).Size;
+		}
+	}
+
+	// Componentes muy grandes: el chunk crece para que quepan al menos 16 filas
+	m_ChunkSize = std::max(ChunkBytes, AlignUp(rowBytes * 16, ChunkAlign));
+	m_Capacity = m_ChunkSize / rowBytes;
+
+	// Ajusta la capacidad hasta que las columnas alineadas quepan en el chunk
+	while (true)
+	{
+		uint32_t offset = m_Capacity * sizeof(EntityID);
+
+		for (ComponentID id : m_Components)
+		{
+			const ComponentInfo& info = ComponentRegistry::Info(id);
+			offset = AlignUp(offset, std::max(info.Align, 16u));
+			m_Offsets[id] = offset;
+			offset += m_Capacity * info.Size;
+		}
+
+		if (offset <= m_ChunkSize)
+			break;
+
+		m_Capacity--;
+	}
+}
+
+void Archetype::Allocate(EntityID entity, uint32_t& chunk, uint32_t& row)
+{
+	if (m_Chunks.empty() || m_Chunks.back().Count == m_Capacity)
+	{
+		Chunk newChunk;
+		newChunk.Data.reset((uint8_t*)::operator new(m_ChunkSize, std::align_val_t(ChunkAlign)));
+		m_Chunks.push_back(std::move(newChunk));
+	}
+
+	chunk = (uint32_t)m_Chunks.size() - 1;
+	Chunk& target = m_Chunks[chunk];
+	row = target.Count++;
+
+	Entities(target)[row] = entity;
+	m_EntityCount++;
+}
+
+EntityID Archetype::Remove(uint32_t chunk, uint32_t row)
+{
+	Chunk& last = m_Chunks.back();
+	uint32_t lastChunk = (uint32_t)m_Chunks.size() - 1;
+	uint32_t lastRow = last.Count - 1;
+
+	EntityID moved;
+
+	if (chunk != lastChunk || row != lastRow)
+	{
+		Chunk& target = m_Chunks[chunk];
+
+		for (ComponentID id : m_Components)
+		{
+			uint32_t size = ComponentRegistry::Info(id).Size;
+			memcpy(Column(target, id) + (size_t)row * size,
+				Column(last, id) + (size_t)lastRow * size,
+				size);
+		}
+
+		moved = Entities(last)[lastRow];
+		Entities(target)[row] = moved;
+	}
+
+	last.Count--;
+	m_EntityCount--;
+
+	if (last.Count == 0)
+		m_Chunks.pop_back();
+
+	return moved;
+}
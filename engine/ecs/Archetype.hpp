@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include "EntityID.hpp"
+#include "Component.hpp"
+
+// Bloque de memoria con capacidad fija: una columna contigua por componente (SoA)
+struct Chunk {
+	struct Deleter { void operator()(uint8_t* data) const; };
+
+	std::unique_ptr<uint8_t, Deleter> Data;
+	uint32_t Count = 0;
+};
+
+// Todas las entidades con exactamente el mismo conjunto de componentes.
+// Las filas se mantienen compactas: al borrar, la última fila ocupa el hueco.
+class Archetype {
+public:
+	static constexpr uint32_t ChunkBytes = 16 * 1024;
+	static constexpr uint32_t ChunkAlign = 64;
+
+	Archetype(ComponentMask mask);
+
+	ComponentMask GetMask() const { return m_Mask; }
+	uint32_t GetCapacity() const { return m_Capacity; }
+	uint32_t GetEntityCount() const { return m_EntityCount; }
+	const std::vector<ComponentID>& GetComponents() const { return m_Components; }
+
+	bool Has(ComponentID id) const { return (m_Mask >> id) & 1; }
+
+	std::vector<Chunk>& GetChunks() { return m_Chunks; }
+
+	EntityID* Entities(Chunk& chunk) const { return (EntityID*)chunk.Data.get(); }
+
+	uint8_t* Column(Chunk& chunk, ComponentID id) const {
+		return chunk.Data.get() + m_Offsets[id];
+	}
+
+	template<typename T>
+	T* Column(Chunk& chunk) const {
+		return (T*)Column(chunk, ComponentRegistry::ID<T>());
+	}
+
+	uint8_t* Component(uint32_t chunk, uint32_t row, ComponentID id) {
+		return Column(m_Chunks[chunk], id) + (size_t)row * ComponentRegistry::Info(id).Size;
+	}
+
+	// Reserva una fila al final; devuelve (chunk, fila)
+	void Allocate(EntityID entity, uint32_t& chunk, uint32_t& row);
+
+	// Quita la fila; si otra entidad se movió al hueco la devuelve para actualizar su registro
+	EntityID Remove(uint32_t chunk, uint32_t row);
+
+private:
+	ComponentMask m_Mask;
+	std::vector<ComponentID> m_Components;
+	uint32_t m_Offsets[MaxComponents]{};
+	uint32_t m_Capacity = 0;
+	uint32_t m_ChunkSize = ChunkBytes;
+	uint32_t m_EntityCount = 0;
+
+	std::vector<Chunk> m_Chunks;
+};
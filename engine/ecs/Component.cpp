@@ -0,0 +1,41 @@
+#include "Component.hpp"
+#include <mutex>
+#include <vector>
+#include <iostream>
+#include <cstdlib>
+
+static std::vector<ComponentInfo>& Registry()
+{
+	static std::vector<ComponentInfo> registry;
+	return registry;
+}
+
+static std::mutex s_RegistryMutex;
+
+ComponentID ComponentRegistry::Register(uint32_t size, uint32_t align, const char* name)
+{
+	std::lock_guard<std::mutex> lock(s_RegistryMutex);
+
+	auto& registry = Registry();
+
+	// No hay ID que devolver: cualquiera repetido mezclaría dos tipos en las
+	// firmas de los arquetipos y en las columnas de los chunks
+	if (registry.size() >= MaxComponents)
+	{
+		std::cout << "[ECS] ERROR: too many component types (max " << MaxComponents << "), registering " << name << std::endl;
+		std::abort();
+	}
+
+	registry.push_back({ size, align, name });
+	return (ComponentID)(registry.size() - 1);
+}
+
+const ComponentInfo& ComponentRegistry::Info(ComponentID id)
+{
+	return Registry()[id];
+}
+
+uint32_t ComponentRegistry::Count()
+{
+	return (uint32_t)Registry().size();
+}
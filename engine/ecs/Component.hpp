@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+
+using ComponentID = uint32_t;
+using ComponentMask = uint64_t;
+
+static constexpr uint32_t MaxComponents = 64;
+
+struct ComponentInfo {
+	uint32_t Size = 0;
+	uint32_t Align = 0;
+	const char* Name = "";
+};
+
+// Cada tipo de componente recibe un ID la primera vez que se usa.
+// Los componentes se mueven con memcpy entre chunks, por eso deben ser triviales.
+class ComponentRegistry {
+public:
+	template<typename T>
+	static ComponentID ID()
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "ECS components must be trivially copyable");
+		static const ComponentID id = Register(sizeof(T), alignof(T), typeid(T).name());
+		return id;
+	}
+
+	template<typename T>
+	static ComponentMask Mask() { return ComponentMask(1) << ID<T>(); }
+
+	template<typename... Ts>
+	static ComponentMask MaskOf() { return (ComponentMask(0) | ... | Mask<Ts>()); }
+
+	static const ComponentInfo& Info(ComponentID id);
+	static uint32_t Count();
+
+private:
+	static ComponentID Register(uint32_t size, uint32_t align, const char* name);
+};
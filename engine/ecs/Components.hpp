@@ -0,0 +1,20 @@
+#pragma once
+#include <cass_linear.hpp>
+#include <Renderer2D.hpp>
+#include <AnimationLibrary.hpp>
+#include <SkeletonLibrary.hpp>
+
+struct Position {
+	cass::Vector2<float> Value;
+};
+
+struct Velocity {
+	cass::Vector2<float> Value;
+};
+
+// Lo que Renderer2D::DrawSprites necesita por sprite
+using Sprite = SpriteDrawData;
+
+// Animator (AnimationLibrary.hpp) también es un componente: clip, frame y timer
+
+// SkeletonAnimator (SkeletonLibrary.hpp) también: clip, tiempo, mezcla y pose de sus huesos
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+
+// Índice + generación: un ID de una entidad destruida deja de ser válido
+// aunque su índice se reutilice.
+struct EntityID {
+	static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+	uint32_t Index = InvalidIndex;
+	uint32_t Generation = 0;
+
+	bool IsValid() const { return Index != InvalidIndex; }
+
+	bool operator==(const EntityID& other) const {
+		return Index == other.Index && Generation == other.Generation;
+	}
+	bool operator!=(const EntityID& other) const { return !(*this == other); }
+};
+
+template<>
+struct std::hash<EntityID> {
+	size_t operator()(const EntityID& id) const {
+		return std::hash<uint64_t>{}(((uint64_t)id.Generation << 32) | id.Index);
+	}
+};
@@ -0,0 +1,189 @@
+#include "SystemScheduler.hpp"
+#include <JobSystem.hpp>
+#include <Profiler.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+// Los nombres viven mientras dure el programa: m_Systems puede reubicarse al
+// añadir sistemas y el Profiler (y el resumen del replay) guardan el puntero
+static const char* InternName(const std::string& name)
+{
+	static std::mutex mutex;
+	static std::unordered_set<std::string> names;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	return names.insert(name).first->c_str();
+}
+
+void SystemScheduler::Add(const SystemDesc& system)
+{
+	Node node;
+	node.Desc = system;
+	node.Name = InternName(system.Name);
+
+	if (system.Phase == SystemPhase::Render)
+		node.Desc.MainThread = true;
+
+	m_Timings.push_back({ node.Name, 0.0f });
+	m_Systems.push_back(std::move(node));
+}
+
+bool SystemScheduler::HasSystems(SystemPhase phase) const
+{
+	for (const Node& node : m_Systems)
+	{
+		if (node.Enabled && node.Desc.Phase == phase)
+			return true;
+	}
+
+	return false;
+}
+
+void SystemScheduler::SetEnabled(const std::string& name, bool enabled)
+{
+	for (Node& node : m_Systems)
+	{
+		if (node.Desc.Name == name)
+			node.Enabled = enabled;
+	}
+}
+
+static bool Conflicts(const SystemDesc& a, const SystemDesc& b)
+{
+	return (a.Writes & (b.Reads | b.Writes)) || (b.Writes & a.Reads);
+}
+
+void SystemScheduler::BuildGraph(SystemPhase phase)
+{
+	for (Node& node : m_Systems)
+	{
+		node.Dependents.clear();
+		node.DependencyCount = 0;
+	}
+
+	auto active = [this, phase](uint32_t index) {
+		return m_Systems[index].Enabled && m_Systems[index].Desc.Phase == phase;
+	};
+
+	for (uint32_t j = 0; j < m_Systems.size(); j++)
+	{
+		if (!active(j))
+			continue;
+
+		for (uint32_t i = 0; i < j; i++)
+		{
+			if (active(i) && Conflicts(m_Systems[i].Desc, m_Systems[j].Desc))
+			{
+				m_Systems[i].Dependents.push_back(j);
+				m_Systems[j].DependencyCount++;
+			}
+		}
+	}
+}
+
+void SystemScheduler::Run(float deltaTime, SystemPhase phase)
+{
+	// El grafo se rehace cada frame: son pocos sistemas y pueden activarse/desactivarse
+	BuildGraph(phase);
+
+	const uint32_t count = (uint32_t)m_Systems.size();
+
+	std::unique_ptr<std::atomic<uint32_t>[]> remaining(new std::atomic<uint32_t>[count]);
+	std::vector<bool> active(count);
+	uint32_t unfinished = 0;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		remaining[i] = m_Systems[i].DependencyCount;
+		active[i] = m_Systems[i].Enabled && m_Systems[i].Desc.Phase == phase;
+
+		if (active[i])
+			unfinished++;
+		else if (m_Systems[i].Desc.Phase == phase)
+			m_Timings[i].Milliseconds = 0.0f;
+	}
+
+	if (unfinished == 0)
+		return;
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::vector<uint32_t> mainReady;
+	JobCounter counter;
+
+	std::function<void(uint32_t)> launch;
+
+	auto execute = [&](uint32_t index) {
+		Node& node = m_Systems[index];
+
+		auto start = std::chrono::high_resolution_clock::now();
+		node.Desc.Run(m_World, deltaTime);
+		float ms = std::chrono::duration<float, std::milli>(
+			std::chrono::high_resolution_clock::now() - start).count();
+
+		m_Timings[index].Milliseconds = ms;
+		Profiler::Record(m_Timings[index].Name, ms);
+
+		for (uint32_t dependent : node.Dependents)
+		{
+			if (remaining[dependent].fetch_sub(1) == 1)
+				launch(dependent);
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		unfinished--;
+		wake.notify_all();
+	};
+
+	launch = [&](uint32_t index) {
+		if (m_Systems[index].Desc.MainThread)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			mainReady.push_back(index);
+			wake.notify_all();
+		}
+		else
+		{
+			JobSystem::Execute([&execute, index] { execute(index); }, &counter);
+		}
+	};
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (active[i] && m_Systems[i].DependencyCount == 0)
+			launch(i);
+	}
+
+	// El hilo principal ejecuta los sistemas MainThread y ayuda con el resto
+	while (true)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		if (!mainReady.empty())
+		{
+			uint32_t index = mainReady.back();
+			mainReady.pop_back();
+			lock.unlock();
+
+			execute(index);
+			continue;
+		}
+
+		if (unfinished == 0)
+			break;
+
+		lock.unlock();
+
+		if (JobSystem::RunPendingJob())
+			continue;
+
+		lock.lock();
+		wake.wait(lock, [&] { return !mainReady.empty() || unfinished == 0; });
+	}
+
+	JobSystem::Wait(counter);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+#include "World.hpp"
+
+// Update corre antes de OnUpdate; Render cuando la aplicación llama a
+// RenderSystems() con la escena de Renderer2D abierta
+enum class SystemPhase : uint8_t {
+	Update = 0,
+	Render = 1
+};
+
+struct SystemDesc {
+	std::string Name;
+	ComponentMask Reads = 0;
+	ComponentMask Writes = 0;
+	bool MainThread = false;    // p. ej. sistemas que llaman a Renderer2D (los de Render lo son siempre)
+	SystemPhase Phase = SystemPhase::Update;
+	std::function<void(World&, float)> Run;
+};
+
+struct SystemTiming {
+	const char* Name;
+	float Milliseconds;
+};
+
+// Ejecuta los sistemas de un World respetando el orden de registro solo donde
+// hace falta: un sistema espera a otro anterior si alguno escribe un componente
+// que el otro lee o escribe. Los demás corren en paralelo en el JobSystem.
+//
+// Los sistemas no deben crear/destruir entidades ni cambiar sus componentes.
+class SystemScheduler {
+public:
+	SystemScheduler(World& world) : m_World(world) {}
+
+	template<typename... Ts>
+	static ComponentMask Components() { return ComponentRegistry::MaskOf<Ts...>(); }
+
+	void Add(const SystemDesc& system);
+	void SetEnabled(const std::string& name, bool enabled);
+
+	// Ejecuta solo los sistemas de esa fase
+	void Run(float deltaTime, SystemPhase phase = SystemPhase::Update);
+
+	bool HasSystems(SystemPhase phase) const;
+
+	// Una entrada por sistema, en orden de registro, con el tiempo de su última ejecución
+	const std::vector<SystemTiming>& GetTimings() const { return m_Timings; }
+
+private:
+	void BuildGraph(SystemPhase phase);
+
+	struct Node {
+		SystemDesc Desc;
+		const char* Name = nullptr;   // copia estable del nombre: el Profiler guarda el puntero
+		bool Enabled = true;
+		std::vector<uint32_t> Dependents;
+		uint32_t DependencyCount = 0;
+	};
+
+	World& m_World;
+	std::vector<Node> m_Systems;
+	std::vector<SystemTiming> m_Timings;
+};
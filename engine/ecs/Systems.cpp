@@ -0,0 +1,55 @@
+#include "Systems.hpp"
+#include "Components.hpp"
+#include <Profiler.hpp>
+
+void MovementSystem(World& world, float deltaTime)
+{
+	world.ParallelForEachChunk<Position, Velocity>(
+		[deltaTime](uint32_t count, EntityID*, Position* position, Velocity* velocity) {
+			for (uint32_t i = 0; i < count; i++) {
+				position[i].Value.x += velocity[i].Value.x * deltaTime;
+				position[i].Value.y += velocity[i].Value.y * deltaTime;
+			}
+		});
+}
+
+void SpriteAnimationSystem(World& world, float deltaTime)
+{
+	world.ParallelForEachChunk<Animator, Sprite>(
+		[deltaTime](uint32_t count, EntityID*, Animator* animator, Sprite* sprite) {
+			AnimationLibrary::Advance(animator, count, deltaTime, &sprite[0].uv, sizeof(Sprite));
+		});
+}
+
+void SkeletonAnimationSystem(World& world, float deltaTime)
+{
+	world.ParallelForEachChunk<SkeletonAnimator>(
+		[deltaTime](uint32_t count, EntityID*, SkeletonAnimator* animator) {
+			CASS_PROFILE_SCOPE("SkeletonAnimationSystem");
+			SkeletonLibrary::Update(animator, count, deltaTime);
+		});
+}
+
+void SpriteRenderSystem(World& world)
+{
+	world.ForEachChunk<Position, Sprite>(
+		[](uint32_t count, EntityID*, Position* position, Sprite* sprite) {
+			Renderer2D::DrawSprites({
+				.count = count,
+				.positions = &position[0].Value,
+				.positionStride = sizeof(Position),
+				.sprites = sprite
+				});
+		});
+}
+
+void SkeletonRenderSystem(World& world)
+{
+	world.ForEachChunk<Position, SkeletonAnimator>(
+		[](uint32_t count, EntityID*, Position* position, SkeletonAnimator* animator) {
+			// Una muestra por chunk: por personaje el coste del perfilador se come la medida
+			CASS_PROFILE_SCOPE("SkeletonRenderSystem");
+			for (uint32_t i = 0; i < count; i++)
+				SkeletonLibrary::Draw({ .animator = animator[i], .position = position[i].Value });
+		});
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "World.hpp"
+
+// Sistemas básicos sobre los componentes de Components.hpp
+
+// Position += Velocity * dt
+void MovementSystem(World& world, float deltaTime);
+
+// Avanza cada Animator y copia el UV del frame actual al Sprite
+void SpriteAnimationSystem(World& world, float deltaTime);
+
+// Calcula la pose de mundo de cada SkeletonAnimator
+void SkeletonAnimationSystem(World& world, float deltaTime);
+
+// Los sistemas de render llaman a Renderer2D: se registran con
+// Phase = SystemPhase::Render para que corran con la escena abierta
+
+// Envía cada chunk de (Position, Sprite) a Renderer2D en un solo DrawSprites
+void SpriteRenderSystem(World& world);
+
+// Dibuja las piezas de cada esqueleto en su Position
+void SkeletonRenderSystem(World& world);
@@ -0,0 +1,131 @@
+#include "World.hpp"
+
+World::World()
+{
+	GetOrCreateArchetype(0);
+}
+
+World::~World() = default;
+
+EntityID World::Create()
+{
+	return CreateIn(GetOrCreateArchetype(0));
+}
+
+EntityID World::CreateIn(Archetype* archetype)
+{
+	uint32_t index;
+
+	if (!m_FreeList.empty())
+	{
+		index = m_FreeList.back();
+		m_FreeList.pop_back();
+	}
+	else
+	{
+		index = (uint32_t)m_Records.size();
+		m_Records.push_back({});
+	}
+
+	EntityRecord& record = m_Records[index];
+	EntityID entity{ index, record.Generation };
+
+	record.Arch = archetype;
+	archetype->Allocate(entity, record.Chunk, record.Row);
+
+	m_AliveCount++;
+	return entity;
+}
+
+bool World::IsAlive(EntityID entity) const
+{
+	return entity.Index < m_Records.size() &&
+		m_Records[entity.Index].Generation == entity.Generation &&
+		m_Records[entity.Index].Arch != nullptr;
+}
+
+void World::Destroy(EntityID entity)
+{
+	if (!IsAlive(entity))
+		return;
+
+	RemoveFromArchetype(entity);
+
+	EntityRecord& record = m_Records[entity.Index];
+	record.Arch = nullptr;
+	record.Generation++;
+
+	m_FreeList.push_back(entity.Index);
+	m_AliveCount--;
+}
+
+void World::RemoveFromArchetype(EntityID entity)
+{
+	EntityRecord& record = m_Records[entity.Index];
+
+	EntityID moved = record.Arch->Remove(record.Chunk, record.Row);
+
+	if (moved.IsValid())
+	{
+		m_Records[moved.Index].Chunk = record.Chunk;
+		m_Records[moved.Index].Row = record.Row;
+	}
+}
+
+void World::MoveTo(EntityID entity, ComponentMask mask)
+{
+	Archetype* target = GetOrCreateArchetype(mask);
+	EntityRecord& record = m_Records[entity.Index];
+	Archetype* source = record.Arch;
+
+	uint32_t chunk, row;
+	target->Allocate(entity, chunk, row);
+
+	// Copia los componentes que tienen en común
+	for (ComponentID id : source->GetComponents())
+	{
+		if (target->Has(id))
+		{
+			memcpy(target->Component(chunk, row, id),
+				source->Component(record.Chunk, record.Row, id),
+				ComponentRegistry::Info(id).Size);
+		}
+	}
+
+	RemoveFromArchetype(entity);
+
+	record.Arch = target;
+	record.Chunk = chunk;
+	record.Row = row;
+}
+
+Archetype* World::GetOrCreateArchetype(ComponentMask mask)
+{
+	auto it = m_ArchetypeLookup.find(mask);
+	if (it != m_ArchetypeLookup.end())
+		return it->second;
+
+	m_Archetypes.push_back(std::make_unique<Archetype>(mask));
+	Archetype* archetype = m_Archetypes.back().get();
+	m_ArchetypeLookup[mask] = archetype;
+
+	return archetype;
+}
+
+const std::vector<Archetype*>& World::Query(ComponentMask mask)
+{
+	std::lock_guard<std::mutex> lock(m_QueryMutex);
+
+	QueryCache& cache = m_Queries[mask];
+
+	// Solo revisa los arquetipos creados desde la última vez
+	for (; cache.Scanned < m_Archetypes.size(); cache.Scanned++)
+	{
+		Archetype* archetype = m_Archetypes[cache.Scanned].get();
+
+		if ((archetype->GetMask() & mask) == mask)
+			cache.Archetypes.push_back(archetype);
+	}
+
+	return cache.Archetypes;
+}
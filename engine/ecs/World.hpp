@@ -0,0 +1,166 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstring>
+#include <mutex>
+#include <JobSystem.hpp>
+#include "EntityID.hpp"
+#include "Component.hpp"
+#include "Archetype.hpp"
+
+// ECS basado en arquetipos. Las entidades con el mismo conjunto de componentes
+// comparten chunks con una columna contigua por componente, así que las
+// consultas recorren memoria lineal.
+//
+// Crear/destruir entidades o añadir/quitar componentes mientras se itera una
+// consulta no está permitido.
+class World {
+public:
+	World();
+	~World();
+
+	World(const World&) = delete;
+	World& operator=(const World&) = delete;
+
+	EntityID Create();
+
+	template<typename... Ts>
+	EntityID Create(const Ts&... components)
+	{
+		EntityID entity = CreateIn(GetOrCreateArchetype(ComponentRegistry::MaskOf<Ts...>()));
+		(Write(entity, components), ...);
+		return entity;
+	}
+
+	void Destroy(EntityID entity);
+	bool IsAlive(EntityID entity) const;
+
+	template<typename T>
+	void Add(EntityID entity, const T& component = {})
+	{
+		if (!IsAlive(entity))
+			return;
+
+		ComponentMask mask = m_Records[entity.Index].Arch->GetMask();
+
+		if (!(mask & ComponentRegistry::Mask<T>()))
+			MoveTo(entity, mask | ComponentRegistry::Mask<T>());
+
+		Write(entity, component);
+	}
+
+	template<typename T>
+	void Remove(EntityID entity)
+	{
+		if (!IsAlive(entity))
+			return;
+
+		ComponentMask mask = m_Records[entity.Index].Arch->GetMask();
+
+		if (mask & ComponentRegistry::Mask<T>())
+			MoveTo(entity, mask & ~ComponentRegistry::Mask<T>());
+	}
+
+	template<typename T>
+	bool Has(EntityID entity) const
+	{
+		return IsAlive(entity) &&
+			m_Records[entity.Index].Arch->Has(ComponentRegistry::ID<T>());
+	}
+
+	template<typename T>
+	T* Get(EntityID entity)
+	{
+		if (!Has<T>(entity))
+			return nullptr;
+
+		const EntityRecord& record = m_Records[entity.Index];
+		return (T*)record.Arch->Component(record.Chunk, record.Row, ComponentRegistry::ID<T>());
+	}
+
+	// fn(uint32_t count, EntityID* entities, Ts*... columns) una vez por chunk
+	template<typename... Ts, typename Fn>
+	void ForEachChunk(Fn&& fn)
+	{
+		for (Archetype* archetype : Query(ComponentRegistry::MaskOf<Ts...>()))
+		{
+			for (Chunk& chunk : archetype->GetChunks())
+				fn(chunk.Count, archetype->Entities(chunk), archetype->template Column<Ts>(chunk)...);
+		}
+	}
+
+	// Igual que ForEachChunk pero repartiendo los chunks entre los hilos del JobSystem.
+	// fn se llama en paralelo: solo debe tocar las filas del chunk que recibe.
+	template<typename... Ts, typename Fn>
+	void ParallelForEachChunk(Fn&& fn, uint32_t chunksPerJob = 4)
+	{
+		struct ChunkRef { Archetype* Arch; Chunk* Data; };
+
+		std::vector<ChunkRef> chunks;
+		for (Archetype* archetype : Query(ComponentRegistry::MaskOf<Ts...>()))
+		{
+			for (Chunk& chunk : archetype->GetChunks())
+				chunks.push_back({ archetype, &chunk });
+		}
+
+		JobSystem::ParallelFor((uint32_t)chunks.size(), chunksPerJob,
+			[&chunks, &fn](uint32_t begin, uint32_t end) {
+				for (uint32_t i = begin; i < end; i++) {
+					Chunk& chunk = *chunks[i].Data;
+					fn(chunk.Count, chunks[i].Arch->Entities(chunk), chunks[i].Arch->template Column<Ts>(chunk)...);
+				}
+			});
+	}
+
+	// fn(Ts&... components) una vez por entidad
+	template<typename... Ts, typename Fn>
+	void Each(Fn&& fn)
+	{
+		ForEachChunk<Ts...>([&fn](uint32_t count, EntityID*, Ts*... columns) {
+			for (uint32_t i = 0; i < count; i++)
+				fn(columns[i]...);
+		});
+	}
+
+	// Arquetipos que contienen todos los componentes de la máscara (cacheado)
+	const std::vector<Archetype*>& Query(ComponentMask mask);
+
+	uint32_t GetEntityCount() const { return m_AliveCount; }
+	const std::vector<std::unique_ptr<Archetype>>& GetArchetypes() const { return m_Archetypes; }
+
+private:
+	struct EntityRecord {
+		Archetype* Arch = nullptr;
+		uint32_t Chunk = 0;
+		uint32_t Row = 0;
+		uint32_t Generation = 0;
+	};
+
+	struct QueryCache {
+		std::vector<Archetype*> Archetypes;
+		size_t Scanned = 0;    // arquetipos ya revisados
+	};
+
+	Archetype* GetOrCreateArchetype(ComponentMask mask);
+	EntityID CreateIn(Archetype* archetype);
+	void MoveTo(EntityID entity, ComponentMask mask);
+	void RemoveFromArchetype(EntityID entity);
+
+	template<typename T>
+	void Write(EntityID entity, const T& component)
+	{
+		const EntityRecord& record = m_Records[entity.Index];
+		memcpy(record.Arch->Component(record.Chunk, record.Row, ComponentRegistry::ID<T>()),
+			&component, sizeof(T));
+	}
+
+	std::vector<EntityRecord> m_Records;
+	std::vector<uint32_t> m_FreeList;
+	uint32_t m_AliveCount = 0;
+
+	std::vector<std::unique_ptr<Archetype>> m_Archetypes;
+	std::unordered_map<ComponentMask, Archetype*> m_ArchetypeLookup;
+	std::unordered_map<ComponentMask, QueryCache> m_Queries;
+	std::mutex m_QueryMutex;   // los sistemas pueden consultar desde varios hilos
+};
@@ -1,7 +1,51 @@
 #pragma once
 #include <EventType.hpp>
-class Event {
-public:
-    virtual EventType GetType() const = 0;
+
+struct KeyEventData {
+    int KeyCode;
+    int Mods;
+};
+
+struct MouseButtonEventData {
+    int Button;
+    int Mods;
+};
+
+// Coordenadas de la ventana (origen arriba a la izquierda), como Input::GetMousePosition
+struct MouseMovedEventData {
+    float X, Y;
+};
+
+struct MouseScrolledEventData {
+    float XOffset, YOffset;
+};
+
+struct WindowResizeEventData {
+    int Width, Height;
+};
+
+// Evento POD: Type dice qué miembro de la unión es válido. Se copia tal cual
+// a la cola de eventos, sin reservar memoria ni vtable.
+struct Event {
+    EventType Type = EventType::None;
     bool Handled = false;
+
+    union {
+        KeyEventData Key;                 // KeyPressed, KeyReleased
+        MouseButtonEventData MouseButton; // MousePressed, MouseReleased
+        MouseMovedEventData MouseMoved;
+        MouseScrolledEventData MouseScrolled;
+        WindowResizeEventData WindowResize;
+    };
+
+    Event() : Key{} {}
+
+    static Event KeyPressed(int key, int mods = 0) { Event e; e.Type = EventType::KeyPressed; e.Key = { key, mods }; return e; }
+    static Event KeyReleased(int key, int mods = 0) { Event e; e.Type = EventType::KeyReleased; e.Key = { key, mods }; return e; }
+    static Event MousePressed(int button, int mods = 0) { Event e; e.Type = EventType::MousePressed; e.MouseButton = { button, mods }; return e; }
+    static Event MouseReleased(int button, int mods = 0) { Event e; e.Type = EventType::MouseReleased; e.MouseButton = { button, mods }; return e; }
+    static Event MouseMove(float x, float y) { Event e; e.Type = EventType::MouseMoved; e.MouseMoved = { x, y }; return e; }
+    static Event MouseScroll(float x, float y) { Event e; e.Type = EventType::MouseScrolled; e.MouseScrolled = { x, y }; return e; }
+    static Event Resize(int width, int height) { Event e; e.Type = EventType::WindowResize; e.WindowResize = { width, height }; return e; }
+    static Event Close() { Event e; e.Type = EventType::WindowClose; return e; }
 };
@@ -0,0 +1,53 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "Event.hpp"
+
+// Devuelve true si el evento queda consumido y no debe llegar a capas inferiores
+using EventHandlerFn = bool(*)(void* context, Event& e);
+
+struct EventLayer {
+    EventHandlerFn Handler = nullptr;
+    void* Context = nullptr;
+    int Priority = 0;    // mayor = recibe antes (overlays, UI)
+};
+
+// Reparte cada evento por las capas de mayor a menor prioridad hasta que una
+// lo consume. Las capas son punteros a función: sin std::function ni virtuales.
+class EventDispatcher {
+public:
+    void PushLayer(const EventLayer& layer)
+    {
+        auto it = m_Layers.begin();
+        while (it != m_Layers.end() && it->Priority >= layer.Priority)
+            ++it;
+        m_Layers.insert(it, layer);
+    }
+
+    void PopLayer(void* context)
+    {
+        for (auto it = m_Layers.begin(); it != m_Layers.end(); ++it) {
+            if (it->Context == context) {
+                m_Layers.erase(it);
+                return;
+            }
+        }
+    }
+
+    void Dispatch(Event& e) const
+    {
+        for (const EventLayer& layer : m_Layers) {
+            if (layer.Handler(layer.Context, e)) {
+                e.Handled = true;
+                return;
+            }
+        }
+    }
+
+    // Ayuda para registrar un método: PushLayer({ EventDispatcher::Method<T, &T::OnEvent>, this })
+    template<typename T, bool (T::*Fn)(Event&)>
+    static bool Method(void* context, Event& e) { return (((T*)context)->*Fn)(e); }
+
+private:
+    std::vector<EventLayer> m_Layers;
+};
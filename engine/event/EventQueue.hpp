@@ -0,0 +1,56 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include "Event.hpp"
+
+// Cola circular sin locks para un productor y un consumidor (p. ej. el hilo
+// que hace glfwPollEvents y el que procesa la entrada). Capacity debe ser
+// potencia de dos. Si está llena, Push descarta el evento y lo cuenta.
+template<uint32_t Capacity = 1024>
+class EventQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    // Solo desde el hilo productor
+    bool Push(const Event& e)
+    {
+        uint32_t tail = m_Tail.load(std::memory_order_relaxed);
+
+        if (tail - m_Head.load(std::memory_order_acquire) == Capacity) {
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        m_Events[tail & (Capacity - 1)] = e;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Solo desde el hilo consumidor
+    bool Pop(Event& e)
+    {
+        uint32_t head = m_Head.load(std::memory_order_relaxed);
+
+        if (head == m_Tail.load(std::memory_order_acquire))
+            return false;
+
+        e = m_Events[head & (Capacity - 1)];
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool IsEmpty() const {
+        return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+    }
+
+    uint32_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::array<Event, Capacity> m_Events;
+
+    // En líneas de caché distintas para que productor y consumidor no se pisen
+    alignas(64) std::atomic<uint32_t> m_Head{ 0 };
+    alignas(64) std::atomic<uint32_t> m_Tail{ 0 };
+    std::atomic<uint32_t> m_Dropped{ 0 };
+};
@@ -1,14 +0,0 @@
-class MousePressedEvent : public Event
-{
-private:
-    int m_Button;
-
-public:
-    MousePressedEvent(int button): m_Button(button) {}
-
-    int GetButton() const { return m_Button; }
-
-    EventType GetType() const override {
-        return EventType::MousePressed;
-    }
-};
\ No newline at end of file
@@ -1,36 +1,78 @@
 #include "Input.hpp"
 #include <GLFW/glfw3.h>
-#include "Application.hpp"
 
-bool Input::IsKeyPressed(int keycode) {
-    auto& app = Application::Get();
-    auto* window = static_cast<GLFWwindow*>(
-        app.GetWindow().GetNativeWindow()
-        );
+InputSnapshot Input::s_Current;
+InputSnapshot Input::s_Pending;
 
-    int state = glfwGetKey(window, keycode);
-    return state == GLFW_PRESS || state == GLFW_REPEAT;
+static void SetBit(uint64_t* bits, int key, bool value)
+{
+    if ((unsigned)key >= InputSnapshot::KeyCount)
+        return;
+
+    uint64_t mask = 1ull << (key & 63);
+    bits[key >> 6] = value ? bits[key >> 6] | mask : bits[key >> 6] & ~mask;
 }
 
-bool Input::IsMousePressed(int buttoncode)
+static void SetBit(uint8_t& bits, int button, bool value)
 {
-    auto& app = Application::Get();
-    auto* window = static_cast<GLFWwindow*>(
-        app.GetWindow().GetNativeWindow()
-        );
+    if ((unsigned)button >= InputSnapshot::MouseButtonCount)
+        return;
 
-    int state = glfwGetMouseButton(window, buttoncode);
-    return state == GLFW_PRESS;
+    uint8_t mask = (uint8_t)(1u << button);
+    bits = value ? bits | mask : bits & ~mask;
 }
 
-cass::Vector2<float> Input::GetMousePosition()
+void Input::Init(void* nativeWindow)
 {
-    auto& window = Application::Get().GetWindow();
-    GLFWwindow* glfwWindow = (GLFWwindow*)window.GetNativeWindow();
-
     double x, y;
-    glfwGetCursorPos(glfwWindow, &x, &y);
+    glfwGetCursorPos((GLFWwindow*)nativeWindow, &x, &y);
+
+    s_Pending.MousePosition = { (float)x, (float)y };
+    s_Current.MousePosition = s_Pending.MousePosition;
+}
 
+void Input::OnEvent(const Event& e)
+{
+    switch (e.Type)
+    {
+    case EventType::KeyPressed:
+        SetBit(s_Pending.KeysDown, e.Key.KeyCode, true);
+        SetBit(s_Pending.KeysPressed, e.Key.KeyCode, true);
+        break;
+    case EventType::KeyReleased:
+        SetBit(s_Pending.KeysDown, e.Key.KeyCode, false);
+        SetBit(s_Pending.KeysReleased, e.Key.KeyCode, true);
+        break;
+    case EventType::MousePressed:
+        SetBit(s_Pending.MouseDown, e.MouseButton.Button, true);
+        SetBit(s_Pending.MousePressed, e.MouseButton.Button, true);
+        break;
+    case EventType::MouseReleased:
+        SetBit(s_Pending.MouseDown, e.MouseButton.Button, false);
+        SetBit(s_Pending.MouseReleased, e.MouseButton.Button, true);
+        break;
+    case EventType::MouseMoved:
+        s_Pending.MousePosition = { e.MouseMoved.X, e.MouseMoved.Y };
+        break;
+    case EventType::MouseScrolled:
+        s_Pending.Scroll += { e.MouseScrolled.XOffset, e.MouseScrolled.YOffset };
+        break;
+    default:
+        break;
+    }
+}
+
+void Input::NewFrame()
+{
+    s_Pending.MouseDelta = s_Pending.MousePosition - s_Current.MousePosition;
+    s_Current = s_Pending;
 
-    return { (float)x,(float)y };
+    // Los flancos y el scroll son de un solo frame; lo mantenido sigue
+    for (int i = 0; i < InputSnapshot::KeyCount / 64; i++) {
+        s_Pending.KeysPressed[i] = 0;
+        s_Pending.KeysReleased[i] = 0;
+    }
+    s_Pending.MousePressed = 0;
+    s_Pending.MouseReleased = 0;
+    s_Pending.Scroll = {};
 }
@@ -1,9 +1,67 @@
 #pragma once
+#include <cstdint>
 #include <cass_linear.hpp>
+#include <Event.hpp>
 
+// Estado de teclado y ratón de un frame. Es POD: se puede copiar, guardar y
+// reproducir. Down = pulsado ahora; Pressed/Released = hubo pulsación/suelta
+// durante el frame (no se pierden los toques más cortos que un frame).
+struct InputSnapshot {
+    static constexpr int KeyCount = 512;        // > GLFW_KEY_LAST
+    static constexpr int MouseButtonCount = 8;  // GLFW_MOUSE_BUTTON_LAST + 1
+
+    uint64_t KeysDown[KeyCount / 64] = {};
+    uint64_t KeysPressed[KeyCount / 64] = {};
+    uint64_t KeysReleased[KeyCount / 64] = {};
+
+    uint8_t MouseDown = 0;
+    uint8_t MousePressed = 0;
+    uint8_t MouseReleased = 0;
+
+    cass::Vector2<float> MousePosition;
+    cass::Vector2<float> MouseDelta;
+    cass::Vector2<float> Scroll;
+
+    static bool Test(const uint64_t* bits, int key) {
+        return (unsigned)key < KeyCount && (bits[key >> 6] >> (key & 63)) & 1;
+    }
+
+    static bool Test(uint8_t bits, int button) {
+        return (unsigned)button < MouseButtonCount && (bits >> button) & 1;
+    }
+};
+
+// Las consultas leen la instantánea del frame actual, que solo cambia en
+// NewFrame (hilo principal, antes de los sistemas). Leerla desde otros hilos
+// durante el frame es seguro.
 class Input {
 public:
-    static bool IsKeyPressed(int keycode);
-    static bool IsMousePressed(int buttoncode);
-    static cass::Vector2<float> GetMousePosition();
+    // Mantenidos
+    static bool IsKeyPressed(int keycode) { return InputSnapshot::Test(s_Current.KeysDown, keycode); }
+    static bool IsMousePressed(int buttoncode) { return InputSnapshot::Test(s_Current.MouseDown, buttoncode); }
+
+    // Flancos de este frame
+    static bool WasKeyPressed(int keycode) { return InputSnapshot::Test(s_Current.KeysPressed, keycode); }
+    static bool WasKeyReleased(int keycode) { return InputSnapshot::Test(s_Current.KeysReleased, keycode); }
+    static bool WasMousePressed(int buttoncode) { return InputSnapshot::Test(s_Current.MousePressed, buttoncode); }
+    static bool WasMouseReleased(int buttoncode) { return InputSnapshot::Test(s_Current.MouseReleased, buttoncode); }
+
+    static cass::Vector2<float> GetMousePosition() { return s_Current.MousePosition; }
+    static cass::Vector2<float> GetMouseDelta() { return s_Current.MouseDelta; }
+    static cass::Vector2<float> GetScrollDelta() { return s_Current.Scroll; }
+
+    static const InputSnapshot& GetSnapshot() { return s_Current; }
+    // Sustituye la instantánea del frame (p. ej. al reproducir una grabación)
+    static void SetSnapshot(const InputSnapshot& snapshot) { s_Current = snapshot; }
+
+    // Toma la posición inicial del cursor
+    static void Init(void* nativeWindow); // GLFWwindow*
+    // Acumula un evento de la ventana en el estado en curso
+    static void OnEvent(const Event& e);
+    // Publica lo acumulado como instantánea del frame y empieza uno nuevo
+    static void NewFrame();
+
+private:
+    static InputSnapshot s_Current;
+    static InputSnapshot s_Pending;
 };
@@ -0,0 +1,157 @@
+#include "InputRecorder.hpp"
+#include <cstring>
+#include <iostream>
+
+static constexpr char Magic[4] = { 'C', 'I', 'N', 'P' };
+static constexpr uint32_t Version = 1;
+static constexpr uint32_t WordCount = sizeof(InputSnapshot) / 4;
+
+static_assert(sizeof(InputSnapshot) % 4 == 0 && WordCount <= 64, "InputSnapshot must fit in the 64-word change mask");
+
+bool InputRecorder::Begin(const std::string& path)
+{
+    End();
+
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_File.is_open()) {
+        std::cout << "Fail to open input recording " << path << "\n";
+        return false;
+    }
+
+    m_Previous = {};
+    m_FrameCount = 0;
+
+    m_File.write(Magic, sizeof(Magic));
+    m_File.write((const char*)&Version, sizeof(Version));
+    m_File.write((const char*)&m_FrameCount, sizeof(m_FrameCount));
+    return true;
+}
+
+void InputRecorder::Record(const InputSnapshot& snapshot, float deltaTime)
+{
+    if (!m_File.is_open())
+        return;
+
+    uint32_t current[WordCount];
+    uint32_t previous[WordCount];
+    std::memcpy(current, &snapshot, sizeof(InputSnapshot));
+    std::memcpy(previous, &m_Previous, sizeof(InputSnapshot));
+
+    uint64_t mask = 0;
+    for (uint32_t i = 0; i < WordCount; i++) {
+        if (current[i] != previous[i])
+            mask |= 1ull << i;
+    }
+
+    m_File.write((const char*)&deltaTime, sizeof(deltaTime));
+    m_File.write((const char*)&mask, sizeof(mask));
+
+    for (uint32_t i = 0; i < WordCount; i++) {
+        if (mask & (1ull << i))
+            m_File.write((const char*)&current[i], sizeof(uint32_t));
+    }
+
+    m_Previous = snapshot;
+    m_FrameCount++;
+}
+
+void InputRecorder::End()
+{
+    if (!m_File.is_open())
+        return;
+
+    // El nº de frames se conoce al final: se escribe sobre la cabecera
+    m_File.seekp(sizeof(Magic) + sizeof(Version));
+    m_File.write((const char*)&m_FrameCount, sizeof(m_FrameCount));
+    m_File.close();
+}
+
+bool InputReplay::Open(const std::string& path)
+{
+    m_File.close();
+    m_File.open(path, std::ios::binary);
+
+    if (!m_File.is_open()) {
+        std::cout << "Fail to open input recording " << path << "\n";
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version = 0;
+    m_File.read(magic, sizeof(magic));
+    m_File.read((char*)&version, sizeof(version));
+    m_File.read((char*)&m_FrameCount, sizeof(m_FrameCount));
+
+    if (!m_File || std::memcmp(magic, Magic, sizeof(Magic)) != 0 || version != Version) {
+        std::cout << "Invalid input recording " << path << "\n";
+        m_File.close();
+        return false;
+    }
+
+    m_Previous = {};
+    m_Frame = 0;
+    return true;
+}
+
+void InputReplay::SynthesizeEvents(const InputSnapshot& snapshot, std::vector<Event>& out)
+{
+    if (snapshot.MouseDelta.x != 0.0f || snapshot.MouseDelta.y != 0.0f)
+        out.push_back(Event::MouseMove(snapshot.MousePosition.x, snapshot.MousePosition.y));
+
+    // Con los dos flancos en el mismo frame, Down dice cuál fue el último
+    for (int key = 0; key < InputSnapshot::KeyCount; key++) {
+        bool pressed = InputSnapshot::Test(snapshot.KeysPressed, key);
+        bool released = InputSnapshot::Test(snapshot.KeysReleased, key);
+        if (!pressed && !released)
+            continue;
+
+        bool down = InputSnapshot::Test(snapshot.KeysDown, key);
+        if (released && down) out.push_back(Event::KeyReleased(key));
+        if (pressed) out.push_back(Event::KeyPressed(key));
+        if (released && !down) out.push_back(Event::KeyReleased(key));
+    }
+
+    for (int button = 0; button < InputSnapshot::MouseButtonCount; button++) {
+        bool pressed = InputSnapshot::Test(snapshot.MousePressed, button);
+        bool released = InputSnapshot::Test(snapshot.MouseReleased, button);
+        if (!pressed && !released)
+            continue;
+
+        bool down = InputSnapshot::Test(snapshot.MouseDown, button);
+        if (released && down) out.push_back(Event::MouseReleased(button));
+        if (pressed) out.push_back(Event::MousePressed(button));
+        if (released && !down) out.push_back(Event::MouseReleased(button));
+    }
+
+    if (snapshot.Scroll.x != 0.0f || snapshot.Scroll.y != 0.0f)
+        out.push_back(Event::MouseScroll(snapshot.Scroll.x, snapshot.Scroll.y));
+}
+
+bool InputReplay::Next(InputSnapshot& snapshot, float& deltaTime)
+{
+    if (!m_File.is_open() || m_Frame >= m_FrameCount)
+        return false;
+
+    uint64_t mask = 0;
+    m_File.read((char*)&deltaTime, sizeof(deltaTime));
+    m_File.read((char*)&mask, sizeof(mask));
+
+    uint32_t words[WordCount];
+    std::memcpy(words, &m_Previous, sizeof(InputSnapshot));
+
+    for (uint32_t i = 0; i < WordCount; i++) {
+        if (mask & (1ull << i))
+            m_File.read((char*)&words[i], sizeof(uint32_t));
+    }
+
+    if (!m_File) {
+        std::cout << "Input recording ended early at frame " << m_Frame << "\n";
+        m_File.close();
+        return false;
+    }
+
+    std::memcpy(&m_Previous, words, sizeof(InputSnapshot));
+    snapshot = m_Previous;
+    m_Frame++;
+    return true;
+}
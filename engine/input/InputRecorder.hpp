@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Input.hpp"
+
+// Formato: cabecera { "CINP", versión, nº de frames } y por frame
+// { float dt, uint64 máscara, palabras cambiadas }. La máscara marca qué
+// palabras de 32 bits del InputSnapshot difieren del frame anterior, así que
+// un frame sin cambios ocupa 12 bytes.
+class InputRecorder {
+public:
+    ~InputRecorder() { End(); }
+
+    bool Begin(const std::string& path);
+    void Record(const InputSnapshot& snapshot, float deltaTime);
+    void End();
+
+    bool IsRecording() const { return m_File.is_open(); }
+    uint32_t GetFrameCount() const { return m_FrameCount; }
+
+private:
+    std::ofstream m_File;
+    InputSnapshot m_Previous;
+    uint32_t m_FrameCount = 0;
+};
+
+class InputReplay {
+public:
+    bool Open(const std::string& path);
+    // Lee el siguiente frame; false al terminar la grabación
+    bool Next(InputSnapshot& snapshot, float& deltaTime);
+
+    bool IsOpen() const { return m_File.is_open(); }
+    uint32_t GetFrameCount() const { return m_FrameCount; }
+    uint32_t GetFrame() const { return m_Frame; }
+
+    // Eventos equivalentes a una instantánea: movimiento, flancos de teclas y
+    // botones, y scroll. El orden dentro del frame y los modificadores no se
+    // graban; un toque dentro de un mismo frame sale como pulsar + soltar.
+    static void SynthesizeEvents(const InputSnapshot& snapshot, std::vector<Event>& out);
+
+private:
+    std::ifstream m_File;
+    InputSnapshot m_Previous;
+    uint32_t m_FrameCount = 0;
+    uint32_t m_Frame = 0;
+};
@@ -0,0 +1,295 @@
+#include "FlowField.hpp"
+#include <algorithm>
+#include <cmath>
+#include <Profiler.hpp>
+
+static constexpr float Sqrt2 = 1.41421356f;
+static constexpr float InvSqrt2 = 0.70710678f;
+
+// Las cuatro primeras son rectas, las cuatro últimas diagonales
+const int FlowField::s_Offsets[8][2] = { {1,0}, {-1,0}, {0,1}, {0,-1}, {1,1}, {1,-1}, {-1,1}, {-1,-1} };
+
+const cass::Vector2<float> FlowField::s_Directions[9] = {
+	{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+	{ InvSqrt2, InvSqrt2 }, { InvSqrt2, -InvSqrt2 }, { -InvSqrt2, InvSqrt2 }, { -InvSqrt2, -InvSqrt2 },
+	{ 0, 0 }
+};
+
+FlowField::FlowField(const TileGrid& grid, const FlowFieldParams& params)
+	: m_Grid(grid), m_Width(grid.GetWidth()), m_Height(grid.GetHeight()), m_NodesPerUpdate(params.nodesPerUpdate)
+{
+	size_t count = (size_t)m_Width * m_Height;
+	m_Front.Cost.assign(count, Unreachable);
+	m_Front.Direction.assign(count, NoDirection);
+	m_Affected.assign(count, 0);
+}
+
+bool FlowField::CanStep(int x, int y, int d) const
+{
+	int dx = s_Offsets[d][0];
+	int dy = s_Offsets[d][1];
+
+	if (!Walkable(x + dx, y + dy))
+		return false;
+
+	return d < 4 || (Walkable(x + dx, y) && Walkable(x, y + dy));
+}
+
+void FlowField::SetGoal(cass::Vector2<int> goal)
+{
+	if (goal.x == m_Goal.x && goal.y == m_Goal.y)
+		return;
+
+	m_Goal = goal;
+	BeginRebuild();
+}
+
+void FlowField::BeginRebuild()
+{
+	size_t count = (size_t)m_Width * m_Height;
+	m_Back.Cost.assign(count, Unreachable);
+	m_Back.Direction.assign(count, NoDirection);
+	m_Back.Open.clear();
+
+	if (Walkable(m_Goal.x, m_Goal.y)) {
+		uint32_t goal = m_Goal.y * m_Width + m_Goal.x;
+		m_Back.Cost[goal] = 0;
+		m_Back.Open.push_back({ 0, goal });
+	}
+
+	m_Rebuilding = true;
+
+	if (m_NodesPerUpdate == 0)
+		Update();
+}
+
+void FlowField::Update()
+{
+	if (!m_Rebuilding)
+		return;
+
+	CASS_PROFILE_SCOPE("FlowField::Update");
+
+	if (!Propagate(m_Back, m_NodesPerUpdate, nullptr))
+		return;
+
+	for (uint32_t tile = 0; tile < m_Back.Cost.size(); tile++)
+		ComputeDirection(m_Back, tile);
+
+	std::swap(m_Front, m_Back);
+	m_Rebuilding = false;
+}
+
+bool FlowField::Propagate(Field& field, uint32_t budget, std::vector<uint32_t>* touched)
+{
+	uint32_t expanded = 0;
+
+	while (!field.Open.empty()) {
+		if (budget && expanded >= budget)
+			return false;
+
+		std::pop_heap(field.Open.begin(), field.Open.end());
+		OpenEntry entry = field.Open.back();
+		field.Open.pop_back();
+
+		if (entry.Cost > field.Cost[entry.Tile])
+			continue;
+
+		expanded++;
+		int x = entry.Tile % m_Width;
+		int y = entry.Tile / m_Width;
+
+		for (int d = 0; d < 8; d++) {
+			if (!CanStep(x, y, d))
+				continue;
+
+			uint32_t next = (y + s_Offsets[d][1]) * m_Width + (x + s_Offsets[d][0]);
+			float cost = entry.Cost + (d < 4 ? 1.0f : Sqrt2);
+
+			if (cost < field.Cost[next]) {
+				field.Cost[next] = cost;
+				field.Open.push_back({ cost, next });
+				std::push_heap(field.Open.begin(), field.Open.end());
+
+				if (touched)
+					touched->push_back(next);
+			}
+		}
+	}
+
+	return true;
+}
+
+void FlowField::ComputeDirection(Field& field, uint32_t tile)
+{
+	int x = tile % m_Width;
+	int y = tile / m_Width;
+
+	uint8_t best = NoDirection;
+	float bestCost = Unreachable;
+
+	if (field.Cost[tile] != Unreachable && field.Cost[tile] > 0) {
+		for (int d = 0; d < 8; d++) {
+			if (!CanStep(x, y, d))
+				continue;
+
+			float cost = field.Cost[(y + s_Offsets[d][1]) * m_Width + (x + s_Offsets[d][0])] + (d < 4 ? 1.0f : Sqrt2);
+			if (cost < bestCost) {
+				bestCost = cost;
+				best = (uint8_t)d;
+			}
+		}
+	}
+
+	field.Direction[tile] = best;
+}
+
+void FlowField::OnTileChanged(int x, int y)
+{
+	if ((uint32_t)x >= m_Width || (uint32_t)y >= m_Height)
+		return;
+
+	// El campo en uso se repara; uno a medio construir se empieza de nuevo
+	if (m_Grid.IsSolid(x, y))
+		RepairBlocked(x, y);
+	else
+		RepairOpened(x, y);
+
+	if (m_Rebuilding)
+		BeginRebuild();
+}
+
+// Un tile pasa a sólido: solo empeoran los tiles cuyo camino pasaba por él,
+// es decir el subárbol que cuelga de él siguiendo las direcciones.
+void FlowField::RepairBlocked(int x, int y)
+{
+	Field& field = m_Front;
+	std::vector<uint32_t>& affected = m_Touched;
+	affected.clear();
+
+	auto mark = [&](uint32_t tile) {
+		if (!m_Affected[tile]) {
+			m_Affected[tile] = 1;
+			affected.push_back(tile);
+		}
+	};
+
+	uint32_t changed = y * m_Width + x;
+	mark(changed);
+
+	// Vecinos que apuntaban al tile o que pasaban en diagonal por su esquina
+	for (int d = 0; d < 8; d++) {
+		int nx = x + s_Offsets[d][0];
+		int ny = y + s_Offsets[d][1];
+		if ((uint32_t)nx >= m_Width || (uint32_t)ny >= m_Height)
+			continue;
+
+		uint32_t neighbour = ny * m_Width + nx;
+		uint8_t dir = field.Direction[neighbour];
+		if (dir != NoDirection && !CanStep(nx, ny, dir))
+			mark(neighbour);
+	}
+
+	for (size_t i = 0; i < affected.size(); i++) {
+		int ax = affected[i] % m_Width;
+		int ay = affected[i] / m_Width;
+
+		for (int d = 0; d < 8; d++) {
+			int nx = ax + s_Offsets[d][0];
+			int ny = ay + s_Offsets[d][1];
+			if ((uint32_t)nx >= m_Width || (uint32_t)ny >= m_Height)
+				continue;
+
+			uint32_t neighbour = ny * m_Width + nx;
+			uint8_t dir = field.Direction[neighbour];
+			if (dir != NoDirection && nx + s_Offsets[dir][0] == ax && ny + s_Offsets[dir][1] == ay)
+				mark(neighbour);
+		}
+	}
+
+	for (uint32_t tile : affected)
+		field.Cost[tile] = Unreachable;
+
+	// Se vuelve a entrar en la zona desde su borde, que sigue siendo correcto
+	field.Open.clear();
+	for (uint32_t tile : affected) {
+		int ax = tile % m_Width;
+		int ay = tile / m_Width;
+		if (!Walkable(ax, ay))
+			continue;
+
+		float best = (ax == m_Goal.x && ay == m_Goal.y) ? 0.0f : Unreachable;
+		for (int d = 0; d < 8; d++) {
+			if (!CanStep(ax, ay, d))
+				continue;
+
+			uint32_t neighbour = (ay + s_Offsets[d][1]) * m_Width + (ax + s_Offsets[d][0]);
+			if (!m_Affected[neighbour])
+				best = std::min(best, field.Cost[neighbour] + (d < 4 ? 1.0f : Sqrt2));
+		}
+
+		if (best != Unreachable) {
+			field.Cost[tile] = best;
+			field.Open.push_back({ best, tile });
+		}
+	}
+
+	std::make_heap(field.Open.begin(), field.Open.end());
+	Propagate(field, 0, nullptr);
+
+	for (uint32_t tile : affected) {
+		ComputeDirection(field, tile);
+		m_Affected[tile] = 0;
+	}
+}
+
+// Un tile pasa a libre: los costes solo pueden bajar. Se relaja desde sus
+// vecinos, lo que también prueba las diagonales que antes tapaba.
+void FlowField::RepairOpened(int x, int y)
+{
+	Field& field = m_Front;
+	m_Touched.clear();
+	field.Open.clear();
+
+	uint32_t changed = y * m_Width + x;
+	m_Touched.push_back(changed);
+
+	if (x == m_Goal.x && y == m_Goal.y) {
+		field.Cost[changed] = 0;
+		field.Open.push_back({ 0, changed });
+	}
+
+	for (int d = 0; d < 8; d++) {
+		int nx = x + s_Offsets[d][0];
+		int ny = y + s_Offsets[d][1];
+		if ((uint32_t)nx >= m_Width || (uint32_t)ny >= m_Height)
+			continue;
+
+		uint32_t neighbour = ny * m_Width + nx;
+		if (field.Cost[neighbour] != Unreachable)
+			field.Open.push_back({ field.Cost[neighbour], neighbour });
+	}
+
+	std::make_heap(field.Open.begin(), field.Open.end());
+	Propagate(field, 0, &m_Touched);
+
+	// Los tiles con coste nuevo y sus vecinos pueden cambiar de dirección
+	for (uint32_t tile : m_Touched) {
+		int tx = tile % m_Width;
+		int ty = tile / m_Width;
+
+		ComputeDirection(field, tile);
+
+		for (int d = 0; d < 8; d++) {
+			int nx = tx + s_Offsets[d][0];
+			int ny = ty + s_Offsets[d][1];
+			if ((uint32_t)nx < m_Width && (uint32_t)ny < m_Height)
+				ComputeDirection(field, ny * m_Width + nx);
+		}
+	}
+}
+
+cass::Vector2<float> FlowField::Sample(const cass::Vector2<float>& position) const
+{
+	return GetDirection((int)std::floor(position.x), (int)std::floor(position.y));
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <limits>
+#include <TileGrid.hpp>
+
+struct FlowFieldParams {
+	uint32_t nodesPerUpdate = 0;   // 0 = al cambiar de objetivo el campo se recalcula en el acto
+};
+
+// Campo de flujo hacia un objetivo común sobre un TileGrid (8 direcciones,
+// sin cortar esquinas). Cada tile guarda su coste hasta el objetivo y la
+// dirección al vecino que más lo reduce, así que un agente solo lee un byte
+// por frame sin importar cuántos agentes haya.
+//
+// Si cambia un tile solo se repara la zona afectada. Si cambia el objetivo el
+// campo nuevo se construye en un segundo buffer, repartido entre varios
+// Update() según nodesPerUpdate; mientras tanto se sigue usando el anterior.
+class FlowField {
+public:
+	static constexpr float Unreachable = std::numeric_limits<float>::infinity();
+
+	FlowField(const TileGrid& grid, const FlowFieldParams& params = {});
+
+	void SetGoal(cass::Vector2<int> goal);
+	cass::Vector2<int> GetGoal() const { return m_Goal; }
+
+	// Avisar tras cambiar la solidez de un tile
+	void OnTileChanged(int x, int y);
+
+	// Avanza la reconstrucción pendiente (si la hay)
+	void Update();
+	bool IsRebuilding() const { return m_Rebuilding; }
+
+	float GetCost(int x, int y) const {
+		if ((uint32_t)x >= m_Width || (uint32_t)y >= m_Height)
+			return Unreachable;
+		return m_Front.Cost[(size_t)y * m_Width + x];
+	}
+
+	// Dirección unitaria (recta o diagonal) hacia el objetivo; cero en el
+	// objetivo, en sólidos y donde no se puede llegar
+	cass::Vector2<float> GetDirection(int x, int y) const {
+		if ((uint32_t)x >= m_Width || (uint32_t)y >= m_Height)
+			return {};
+		return s_Directions[m_Front.Direction[(size_t)y * m_Width + x]];
+	}
+
+	cass::Vector2<float> Sample(const cass::Vector2<float>& position) const;
+
+private:
+	static constexpr uint8_t NoDirection = 8;
+	static const int s_Offsets[8][2];
+	static const cass::Vector2<float> s_Directions[9];
+
+	struct OpenEntry {
+		float Cost;
+		uint32_t Tile;
+		bool operator<(const OpenEntry& other) const { return Cost > other.Cost; }
+	};
+
+	struct Field {
+		std::vector<float> Cost;
+		std::vector<uint8_t> Direction;
+		std::vector<OpenEntry> Open;
+	};
+
+	bool Walkable(int x, int y) const {
+		return (uint32_t)x < m_Width && (uint32_t)y < m_Height && !m_Grid.IsSolid(x, y);
+	}
+
+	// ¿Se puede dar el paso d desde (x, y)? Las diagonales exigen libres las dos ortogonales
+	bool CanStep(int x, int y, int d) const;
+
+	void BeginRebuild();
+	// Dijkstra desde lo que haya en Open; budget = 0 sin límite. true al terminar.
+	bool Propagate(Field& field, uint32_t budget, std::vector<uint32_t>* touched);
+	void ComputeDirection(Field& field, uint32_t tile);
+
+	void RepairBlocked(int x, int y);
+	void RepairOpened(int x, int y);
+
+	const TileGrid& m_Grid;
+	uint32_t m_Width;
+	uint32_t m_Height;
+	uint32_t m_NodesPerUpdate;
+
+	cass::Vector2<int> m_Goal{ -1, -1 };
+	Field m_Front;
+	Field m_Back;
+	bool m_Rebuilding = false;
+
+	std::vector<uint32_t> m_Touched;
+	std::vector<uint8_t> m_Affected;
+};
@@ -0,0 +1,838 @@
+#include "Pathfinder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <JobSystem.hpp>
+#include <Profiler.hpp>
+
+static constexpr float Sqrt2 = 1.41421356f;
+static constexpr uint32_t NoParent = 0xFFFFFFFF;
+
+static float Octile(cass::Vector2<int> a, cass::Vector2<int> b)
+{
+	int dx = std::abs(a.x - b.x);
+	int dy = std::abs(a.y - b.y);
+	return (float)std::max(dx, dy) + (Sqrt2 - 1.0f) * (float)std::min(dx, dy);
+}
+
+static int Sign(int value)
+{
+	return (value > 0) - (value < 0);
+}
+
+// Memoria de una búsqueda. Las marcas evitan limpiar los arrays en cada búsqueda:
+// una entrada solo vale si su Stamp coincide con Current.
+struct Pathfinder::SearchContext {
+	struct OpenEntry {
+		float F;
+		float G;
+		uint32_t Node;
+		bool operator<(const OpenEntry& other) const { return F > other.F; }
+	};
+
+	std::vector<float> G;
+	std::vector<uint32_t> Parent;
+	std::vector<uint32_t> Stamp;
+	std::vector<uint32_t> Closed;
+	uint32_t Current = 0;
+	std::vector<OpenEntry> Open;
+
+	std::vector<std::pair<uint32_t, float>> StartLinks;
+	std::vector<std::pair<uint32_t, float>> GoalLinks;
+	std::vector<cass::Vector2<int>> AbstractPath;
+	std::vector<cass::Vector2<int>> Segment;
+
+	void Begin(size_t size)
+	{
+		if (G.size() < size) {
+			G.resize(size);
+			Parent.resize(size);
+			Stamp.resize(size, 0);
+			Closed.resize(size, 0);
+		}
+
+		if (++Current == 0) {
+			std::fill(Stamp.begin(), Stamp.end(), 0);
+			std::fill(Closed.begin(), Closed.end(), 0);
+			Current = 1;
+		}
+
+		Open.clear();
+	}
+
+	bool Visited(uint32_t node) const { return Stamp[node] == Current; }
+	bool IsClosed(uint32_t node) const { return Closed[node] == Current; }
+
+	void Push(uint32_t node, float g, float h, uint32_t parent)
+	{
+		G[node] = g;
+		Parent[node] = parent;
+		Stamp[node] = Current;
+		Open.push_back({ g + h, g, node });
+		std::push_heap(Open.begin(), Open.end());
+	}
+
+	// Saca el mejor nodo abierto que siga vigente; false si no queda ninguno
+	bool Pop(uint32_t& node)
+	{
+		while (!Open.empty()) {
+			std::pop_heap(Open.begin(), Open.end());
+			OpenEntry entry = Open.back();
+			Open.pop_back();
+
+			if (IsClosed(entry.Node) || entry.G > G[entry.Node])
+				continue;
+
+			Closed[entry.Node] = Current;
+			node = entry.Node;
+			return true;
+		}
+
+		return false;
+	}
+};
+
+Pathfinder::Pathfinder(const TileGrid& grid, const PathfinderParams& params)
+	: m_Grid(grid), m_ClusterSize(std::max(params.clusterSize, 4u)), m_CacheCapacity(params.cacheCapacity)
+{
+	BuildAbstraction();
+}
+
+Pathfinder::~Pathfinder() = default;
+
+static uint64_t Mix64(uint64_t value)
+{
+	// Finalizador de splitmix64
+	value ^= value >> 30;
+	value *= 0xBF58476D1CE4E5B9ull;
+	value ^= value >> 27;
+	value *= 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
+
+size_t Pathfinder::PathKeyHash::operator()(const PathKey& key) const
+{
+	uint64_t start = ((uint64_t)(uint32_t)key.Start.x << 32) | (uint32_t)key.Start.y;
+	uint64_t goal = ((uint64_t)(uint32_t)key.Goal.x << 32) | (uint32_t)key.Goal.y;
+	return (size_t)Mix64(start ^ Mix64(goal));
+}
+
+Pathfinder::SearchContext* Pathfinder::AcquireContext() const
+{
+	std::lock_guard<std::mutex> lock(m_ContextMutex);
+
+	if (m_FreeContexts.empty()) {
+		m_Contexts.push_back(std::make_unique<SearchContext>());
+		return m_Contexts.back().get();
+	}
+
+	SearchContext* context = m_FreeContexts.back();
+	m_FreeContexts.pop_back();
+	return context;
+}
+
+void Pathfinder::ReleaseContext(SearchContext* context) const
+{
+	std::lock_guard<std::mutex> lock(m_ContextMutex);
+	m_FreeContexts.push_back(context);
+}
+
+// ---------------------------------------------------------------------------
+// Abstracción HPA*
+// ---------------------------------------------------------------------------
+
+void Pathfinder::BuildAbstraction()
+{
+	uint32_t width = m_Grid.GetWidth();
+	uint32_t height = m_Grid.GetHeight();
+
+	m_ClustersX = (width + m_ClusterSize - 1) / m_ClusterSize;
+	m_ClustersY = (height + m_ClusterSize - 1) / m_ClusterSize;
+
+	m_Clusters.assign((size_t)m_ClustersX * m_ClustersY, {});
+	m_BorderNodes.assign(m_Clusters.size() * 2, {});
+	m_Nodes.clear();
+	m_FreeNodes.clear();
+	m_Cache.clear();
+	m_Stats.AbstractNodes = 0;
+
+	for (uint32_t cy = 0; cy < m_ClustersY; cy++) {
+		for (uint32_t cx = 0; cx < m_ClustersX; cx++) {
+			Cluster& cluster = m_Clusters[cy * m_ClustersX + cx];
+			cluster.MinX = cx * m_ClusterSize;
+			cluster.MinY = cy * m_ClusterSize;
+			cluster.MaxX = std::min((cx + 1) * m_ClusterSize, width) - 1;
+			cluster.MaxY = std::min((cy + 1) * m_ClusterSize, height) - 1;
+		}
+	}
+
+	for (uint32_t c = 0; c < m_Clusters.size(); c++) {
+		BuildBorder(c, false);
+		BuildBorder(c, true);
+	}
+
+	// Cada cluster solo toca las aristas de sus propios nodos
+	JobSystem::ParallelFor((uint32_t)m_Clusters.size(), 16, [this](uint32_t begin, uint32_t end) {
+		SearchContext* context = AcquireContext();
+		for (uint32_t c = begin; c < end; c++)
+			BuildIntraEdges(c, *context);
+		ReleaseContext(context);
+	});
+
+	m_AnyDirty = false;
+}
+
+uint32_t Pathfinder::AddNode(cass::Vector2<int> tile)
+{
+	uint32_t node;
+
+	if (!m_FreeNodes.empty()) {
+		node = m_FreeNodes.back();
+		m_FreeNodes.pop_back();
+	}
+	else {
+		node = (uint32_t)m_Nodes.size();
+		m_Nodes.emplace_back();
+	}
+
+	AbstractNode& n = m_Nodes[node];
+	n.Tile = tile;
+	n.Cluster = ClusterIndex(tile.x, tile.y);
+	n.Alive = true;
+	n.Edges.clear();
+
+	m_Clusters[n.Cluster].Nodes.push_back(node);
+	m_Stats.AbstractNodes++;
+	return node;
+}
+
+void Pathfinder::RemoveNode(uint32_t node)
+{
+	AbstractNode& n = m_Nodes[node];
+	std::vector<uint32_t>& nodes = m_Clusters[n.Cluster].Nodes;
+	nodes.erase(std::remove(nodes.begin(), nodes.end(), node), nodes.end());
+
+	n.Alive = false;
+	n.Edges.clear();
+	m_FreeNodes.push_back(node);
+	m_Stats.AbstractNodes--;
+}
+
+// top = false: borde derecho del cluster; top = true: borde superior.
+// Cada tramo continuo de pares libres a ambos lados es una entrada: los
+// cortos tienen una transición en el centro, los largos una en cada extremo.
+void Pathfinder::BuildBorder(uint32_t cluster, bool top)
+{
+	uint32_t cx = cluster % m_ClustersX;
+	uint32_t cy = cluster / m_ClustersX;
+
+	if ((!top && cx + 1 >= m_ClustersX) || (top && cy + 1 >= m_ClustersY))
+		return;
+
+	const Cluster& c = m_Clusters[cluster];
+	std::vector<uint32_t>& border = m_BorderNodes[cluster * 2 + (top ? 1 : 0)];
+
+	int first = top ? c.MinX : c.MinY;
+	int last = top ? c.MaxX : c.MaxY;
+
+	auto inside = [&](int i) { return top ? cass::Vector2<int>(i, c.MaxY) : cass::Vector2<int>(c.MaxX, i); };
+	auto outside = [&](int i) { return top ? cass::Vector2<int>(i, c.MaxY + 1) : cass::Vector2<int>(c.MaxX + 1, i); };
+	auto open = [&](int i) {
+		cass::Vector2<int> a = inside(i), b = outside(i);
+		return Walkable(a.x, a.y) && Walkable(b.x, b.y);
+	};
+
+	auto addTransition = [&](int i) {
+		uint32_t a = AddNode(inside(i));
+		uint32_t b = AddNode(outside(i));
+		m_Nodes[a].Edges.push_back({ b, 1.0f, true });
+		m_Nodes[b].Edges.push_back({ a, 1.0f, true });
+		border.push_back(a);
+		border.push_back(b);
+	};
+
+	int i = first;
+	while (i <= last) {
+		if (!open(i)) {
+			i++;
+			continue;
+		}
+
+		int runStart = i;
+		while (i <= last && open(i))
+			i++;
+		int runEnd = i - 1;
+
+		if (runEnd - runStart + 1 >= 6) {
+			addTransition(runStart);
+			addTransition(runEnd);
+		}
+		else {
+			addTransition((runStart + runEnd) / 2);
+		}
+	}
+}
+
+void Pathfinder::ClearBorder(uint32_t cluster, bool top)
+{
+	std::vector<uint32_t>& border = m_BorderNodes[cluster * 2 + (top ? 1 : 0)];
+
+	for (uint32_t node : border)
+		RemoveNode(node);
+
+	border.clear();
+}
+
+void Pathfinder::BuildIntraEdges(uint32_t cluster, SearchContext& context)
+{
+	const Cluster& c = m_Clusters[cluster];
+
+	for (uint32_t node : c.Nodes) {
+		std::vector<AbstractEdge>& edges = m_Nodes[node].Edges;
+		edges.erase(std::remove_if(edges.begin(), edges.end(),
+			[](const AbstractEdge& edge) { return !edge.Inter; }), edges.end());
+	}
+
+	uint32_t width = m_Grid.GetWidth();
+
+	for (uint32_t node : c.Nodes) {
+		ClusterDijkstra(m_Nodes[node].Tile, c, context);
+
+		for (uint32_t other : c.Nodes) {
+			if (other == node)
+				continue;
+
+			cass::Vector2<int> tile = m_Nodes[other].Tile;
+			uint32_t index = tile.y * width + tile.x;
+
+			if (context.Visited(index))
+				m_Nodes[node].Edges.push_back({ other, context.G[index], false });
+		}
+	}
+}
+
+void Pathfinder::OnTileChanged(int x, int y)
+{
+	if ((uint32_t)x >= m_Grid.GetWidth() || (uint32_t)y >= m_Grid.GetHeight())
+		return;
+
+	m_Clusters[ClusterIndex(x, y)].Dirty = true;
+	m_AnyDirty = true;
+	m_Cache.clear();
+}
+
+void Pathfinder::RebuildDirtyClusters()
+{
+	if (!m_AnyDirty)
+		return;
+
+	CASS_PROFILE_SCOPE("Pathfinder::RebuildDirtyClusters");
+
+	// Un tile cambiado afecta a los cuatro bordes de su cluster, y los
+	// vecinos que comparten esos bordes pierden o ganan nodos
+	std::vector<uint8_t> rebuildBorder(m_BorderNodes.size(), 0);
+	std::vector<uint8_t> rebuildEdges(m_Clusters.size(), 0);
+
+	for (uint32_t c = 0; c < m_Clusters.size(); c++) {
+		if (!m_Clusters[c].Dirty)
+			continue;
+
+		uint32_t cx = c % m_ClustersX;
+		uint32_t cy = c / m_ClustersX;
+
+		rebuildBorder[c * 2 + 0] = rebuildBorder[c * 2 + 1] = 1;
+		rebuildEdges[c] = 1;
+
+		if (cx > 0) {
+			rebuildBorder[(c - 1) * 2 + 0] = 1;
+			rebuildEdges[c - 1] = 1;
+		}
+		if (cy > 0) {
+			rebuildBorder[(c - m_ClustersX) * 2 + 1] = 1;
+			rebuildEdges[c - m_ClustersX] = 1;
+		}
+		if (cx + 1 < m_ClustersX)
+			rebuildEdges[c + 1] = 1;
+		if (cy + 1 < m_ClustersY)
+			rebuildEdges[c + m_ClustersX] = 1;
+
+		m_Clusters[c].Dirty = false;
+	}
+
+	for (uint32_t b = 0; b < rebuildBorder.size(); b++)
+		if (rebuildBorder[b])
+			ClearBorder(b / 2, b % 2);
+
+	for (uint32_t b = 0; b < rebuildBorder.size(); b++)
+		if (rebuildBorder[b])
+			BuildBorder(b / 2, b % 2);
+
+	std::vector<uint32_t> clusters;
+	for (uint32_t c = 0; c < rebuildEdges.size(); c++)
+		if (rebuildEdges[c])
+			clusters.push_back(c);
+
+	JobSystem::ParallelFor((uint32_t)clusters.size(), 4, [&](uint32_t begin, uint32_t end) {
+		SearchContext* context = AcquireContext();
+		for (uint32_t i = begin; i < end; i++)
+			BuildIntraEdges(clusters[i], *context);
+		ReleaseContext(context);
+	});
+
+	m_AnyDirty = false;
+}
+
+// ---------------------------------------------------------------------------
+// Búsquedas
+// ---------------------------------------------------------------------------
+
+// Dijkstra limitado al rectángulo del cluster; deja los costes en context.G
+void Pathfinder::ClusterDijkstra(cass::Vector2<int> source, const Cluster& cluster, SearchContext& context) const
+{
+	static const int Directions[8][2] = { {1,0}, {-1,0}, {0,1}, {0,-1}, {1,1}, {1,-1}, {-1,1}, {-1,-1} };
+
+	uint32_t width = m_Grid.GetWidth();
+	context.Begin((size_t)width * m_Grid.GetHeight());
+	context.Push(source.y * width + source.x, 0.0f, 0.0f, NoParent);
+
+	uint32_t node;
+	while (context.Pop(node)) {
+		int x = node % width;
+		int y = node / width;
+
+		for (const auto& dir : Directions) {
+			int nx = x + dir[0];
+			int ny = y + dir[1];
+
+			if (nx < cluster.MinX || nx > cluster.MaxX || ny < cluster.MinY || ny > cluster.MaxY)
+				continue;
+			if (!Walkable(nx, ny))
+				continue;
+
+			bool diagonal = dir[0] != 0 && dir[1] != 0;
+			if (diagonal && !(Walkable(x + dir[0], y) && Walkable(x, y + dir[1])))
+				continue;
+
+			uint32_t next = ny * width + nx;
+			float g = context.G[node] + (diagonal ? Sqrt2 : 1.0f);
+
+			if (!context.IsClosed(next) && (!context.Visited(next) || g < context.G[next]))
+				context.Push(next, g, 0.0f, node);
+		}
+	}
+}
+
+// Salto en la dirección (dx, dy) desde (x, y) hasta el siguiente punto de
+// interés: el objetivo o una casilla con vecinos forzados. Variante sin
+// cortar esquinas: una diagonal exige libres las dos ortogonales.
+bool Pathfinder::Jump(int x, int y, int dx, int dy, cass::Vector2<int> goal, cass::Vector2<int>& jumpPoint) const
+{
+	while (true) {
+		if (!Walkable(x, y))
+			return false;
+
+		if (x == goal.x && y == goal.y) {
+			jumpPoint = { x, y };
+			return true;
+		}
+
+		if (dx != 0 && dy != 0) {
+			cass::Vector2<int> unused;
+			if (Jump(x + dx, y, dx, 0, goal, unused) || Jump(x, y + dy, 0, dy, goal, unused)) {
+				jumpPoint = { x, y };
+				return true;
+			}
+
+			if (!(Walkable(x + dx, y) && Walkable(x, y + dy)))
+				return false;
+		}
+		else if (dx != 0) {
+			if ((Walkable(x, y - 1) && !Walkable(x - dx, y - 1)) ||
+				(Walkable(x, y + 1) && !Walkable(x - dx, y + 1))) {
+				jumpPoint = { x, y };
+				return true;
+			}
+		}
+		else {
+			if ((Walkable(x - 1, y) && !Walkable(x - 1, y - dy)) ||
+				(Walkable(x + 1, y) && !Walkable(x + 1, y - dy))) {
+				jumpPoint = { x, y };
+				return true;
+			}
+		}
+
+		x += dx;
+		y += dy;
+	}
+}
+
+bool Pathfinder::JumpPointSearch(cass::Vector2<int> start, cass::Vector2<int> goal,
+	std::vector<cass::Vector2<int>>& waypoints, SearchContext& context) const
+{
+	uint32_t width = m_Grid.GetWidth();
+	uint32_t startIndex = start.y * width + start.x;
+	uint32_t goalIndex = goal.y * width + goal.x;
+
+	context.Begin((size_t)width * m_Grid.GetHeight());
+	context.Push(startIndex, 0.0f, Octile(start, goal), NoParent);
+
+	uint32_t node;
+	while (context.Pop(node)) {
+		if (node == goalIndex) {
+			size_t first = waypoints.size();
+			for (uint32_t n = node; n != NoParent; n = context.Parent[n])
+				waypoints.push_back({ (int)(n % width), (int)(n / width) });
+			std::reverse(waypoints.begin() + first, waypoints.end());
+			return true;
+		}
+
+		int x = node % width;
+		int y = node / width;
+
+		// Vecinos podados según la dirección de llegada
+		cass::Vector2<int> neighbours[8];
+		int count = 0;
+		auto add = [&](int nx, int ny) { neighbours[count++] = { nx, ny }; };
+
+		uint32_t parent = context.Parent[node];
+
+		if (parent == NoParent) {
+			bool right = Walkable(x + 1, y), left = Walkable(x - 1, y);
+			bool up = Walkable(x, y + 1), down = Walkable(x, y - 1);
+
+			if (right) add(x + 1, y);
+			if (left) add(x - 1, y);
+			if (up) add(x, y + 1);
+			if (down) add(x, y - 1);
+			if (right && up && Walkable(x + 1, y + 1)) add(x + 1, y + 1);
+			if (right && down && Walkable(x + 1, y - 1)) add(x + 1, y - 1);
+			if (left && up && Walkable(x - 1, y + 1)) add(x - 1, y + 1);
+			if (left && down && Walkable(x - 1, y - 1)) add(x - 1, y - 1);
+		}
+		else {
+			int dx = Sign(x - (int)(parent % width));
+			int dy = Sign(y - (int)(parent / width));
+
+			if (dx != 0 && dy != 0) {
+				bool horizontal = Walkable(x + dx, y);
+				bool vertical = Walkable(x, y + dy);
+
+				if (vertical) add(x, y + dy);
+				if (horizontal) add(x + dx, y);
+				if (horizontal && vertical) add(x + dx, y + dy);
+			}
+			else if (dx != 0) {
+				bool next = Walkable(x + dx, y);
+				bool up = Walkable(x, y + 1);
+				bool down = Walkable(x, y - 1);
+
+				if (next) {
+					add(x + dx, y);
+					if (up) add(x + dx, y + 1);
+					if (down) add(x + dx, y - 1);
+				}
+				if (up) add(x, y + 1);
+				if (down) add(x, y - 1);
+			}
+			else {
+				bool next = Walkable(x, y + dy);
+				bool right = Walkable(x + 1, y);
+				bool left = Walkable(x - 1, y);
+
+				if (next) {
+					add(x, y + dy);
+					if (right) add(x + 1, y + dy);
+					if (left) add(x - 1, y + dy);
+				}
+				if (right) add(x + 1, y);
+				if (left) add(x - 1, y);
+			}
+		}
+
+		for (int i = 0; i < count; i++) {
+			cass::Vector2<int> jumpPoint;
+			if (!Jump(neighbours[i].x, neighbours[i].y, neighbours[i].x - x, neighbours[i].y - y, goal, jumpPoint))
+				continue;
+
+			uint32_t next = jumpPoint.y * width + jumpPoint.x;
+			if (context.IsClosed(next))
+				continue;
+
+			// Entre un nodo y su punto de salto hay una línea recta o diagonal
+			float g = context.G[node] + Octile({ x, y }, jumpPoint);
+
+			if (!context.Visited(next) || g < context.G[next])
+				context.Push(next, g, Octile(jumpPoint, goal), node);
+		}
+	}
+
+	return false;
+}
+
+bool Pathfinder::HierarchicalSearch(cass::Vector2<int> start, cass::Vector2<int> goal,
+	std::vector<cass::Vector2<int>>& waypoints, SearchContext& context) const
+{
+	uint32_t width = m_Grid.GetWidth();
+	uint32_t startCluster = ClusterIndex(start.x, start.y);
+	uint32_t goalCluster = ClusterIndex(goal.x, goal.y);
+
+	// Inicio y objetivo se conectan a los nodos de su cluster sin tocar el grafo,
+	// así varias búsquedas pueden compartirlo en paralelo
+	auto link = [&](cass::Vector2<int> tile, uint32_t cluster, std::vector<std::pair<uint32_t, float>>& links) {
+		links.clear();
+		ClusterDijkstra(tile, m_Clusters[cluster], context);
+
+		for (uint32_t node : m_Clusters[cluster].Nodes) {
+			cass::Vector2<int> t = m_Nodes[node].Tile;
+			uint32_t index = t.y * width + t.x;
+			if (context.Visited(index))
+				links.push_back({ node, context.G[index] });
+		}
+	};
+
+	link(start, startCluster, context.StartLinks);
+	link(goal, goalCluster, context.GoalLinks);
+
+	if (context.StartLinks.empty() || context.GoalLinks.empty())
+		return false;
+
+	// A* sobre el grafo abstracto; start y goal son dos nodos virtuales al final
+	uint32_t startNode = (uint32_t)m_Nodes.size();
+	uint32_t goalNode = startNode + 1;
+
+	auto tileOf = [&](uint32_t node) {
+		return node == startNode ? start : node == goalNode ? goal : m_Nodes[node].Tile;
+	};
+
+	context.Begin(std::max((size_t)width * m_Grid.GetHeight(), (size_t)goalNode + 1));
+	context.Push(startNode, 0.0f, Octile(start, goal), NoParent);
+
+	bool found = false;
+	uint32_t node;
+
+	while (context.Pop(node)) {
+		if (node == goalNode) {
+			found = true;
+			break;
+		}
+
+		auto relax = [&](uint32_t next, float cost) {
+			if (context.IsClosed(next))
+				return;
+
+			float g = context.G[node] + cost;
+			if (!context.Visited(next) || g < context.G[next])
+				context.Push(next, g, Octile(tileOf(next), goal), node);
+		};
+
+		if (node == startNode) {
+			for (const auto& [next, cost] : context.StartLinks)
+				relax(next, cost);
+			continue;
+		}
+
+		for (const AbstractEdge& edge : m_Nodes[node].Edges)
+			relax(edge.To, edge.Cost);
+
+		if (m_Nodes[node].Cluster == goalCluster) {
+			for (const auto& [linked, cost] : context.GoalLinks) {
+				if (linked == node) {
+					relax(goalNode, cost);
+					break;
+				}
+			}
+		}
+	}
+
+	if (!found)
+		return false;
+
+	context.AbstractPath.clear();
+	for (uint32_t n = goalNode; n != NoParent; n = context.Parent[n])
+		context.AbstractPath.push_back(tileOf(n));
+	std::reverse(context.AbstractPath.begin(), context.AbstractPath.end());
+
+	// Refinado: cada tramo abstracto es corto, así que JPS lo resuelve rápido
+	waypoints.push_back(start);
+
+	for (size_t i = 1; i < context.AbstractPath.size(); i++) {
+		cass::Vector2<int> from = context.AbstractPath[i - 1];
+		cass::Vector2<int> to = context.AbstractPath[i];
+
+		if (from.x == to.x && from.y == to.y)
+			continue;
+
+		// Las transiciones entre clusters son pasos ortogonales de un tile
+		if (std::abs(from.x - to.x) + std::abs(from.y - to.y) == 1) {
+			waypoints.push_back(to);
+			continue;
+		}
+
+		context.Segment.clear();
+		if (!JumpPointSearch(from, to, context.Segment, context))
+			return false;
+
+		waypoints.insert(waypoints.end(), context.Segment.begin() + 1, context.Segment.end());
+	}
+
+	return true;
+}
+
+bool Pathfinder::Search(cass::Vector2<int> start, cass::Vector2<int> goal,
+	std::vector<cass::Vector2<int>>& waypoints, SearchContext& context) const
+{
+	waypoints.clear();
+
+	if (!Walkable(start.x, start.y) || !Walkable(goal.x, goal.y))
+		return false;
+
+	if (start.x == goal.x && start.y == goal.y) {
+		waypoints.push_back(start);
+		return true;
+	}
+
+	int distance = std::max(std::abs(start.x - goal.x), std::abs(start.y - goal.y));
+	bool direct = distance <= (int)m_ClusterSize * 2 ||
+		ClusterIndex(start.x, start.y) == ClusterIndex(goal.x, goal.y);
+
+	bool found = direct ?
+		JumpPointSearch(start, goal, waypoints, context) :
+		HierarchicalSearch(start, goal, waypoints, context);
+
+	if (!found) {
+		waypoints.clear();
+		return false;
+	}
+
+	// Fusiona waypoints consecutivos en la misma dirección
+	size_t out = 1;
+	for (size_t i = 1; i < waypoints.size(); i++) {
+		if (out >= 2) {
+			cass::Vector2<int> a = waypoints[out - 2], b = waypoints[out - 1], c = waypoints[i];
+			if (Sign(b.x - a.x) == Sign(c.x - b.x) && Sign(b.y - a.y) == Sign(c.y - b.y) &&
+				(b.x - a.x) * (c.y - b.y) == (b.y - a.y) * (c.x - b.x)) {
+				waypoints[out - 1] = c;
+				continue;
+			}
+		}
+		waypoints[out++] = waypoints[i];
+	}
+	waypoints.resize(out);
+
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// API
+// ---------------------------------------------------------------------------
+
+bool Pathfinder::FindPath(cass::Vector2<int> start, cass::Vector2<int> goal, std::vector<cass::Vector2<int>>& waypoints)
+{
+	RebuildDirtyClusters();
+	m_Stats.Requests++;
+
+	PathKey key{ start, goal };
+	auto cached = m_Cache.find(key);
+
+	if (cached != m_Cache.end()) {
+		m_Stats.CacheHits++;
+		waypoints = cached->second.Waypoints;
+		return cached->second.Found;
+	}
+
+	SearchContext* context = AcquireContext();
+	bool found = Search(start, goal, waypoints, *context);
+	ReleaseContext(context);
+
+	if (m_Cache.size() >= m_CacheCapacity)
+		m_Cache.clear();
+	m_Cache[key] = { found, waypoints };
+
+	return found;
+}
+
+PathHandle Pathfinder::RequestPath(cass::Vector2<int> start, cass::Vector2<int> goal)
+{
+	m_Pending.push_back({ .Start = start, .Goal = goal, .Status = PathStatus::Pending, .Waypoints = {} });
+	return { (uint32_t)m_Pending.size() - 1, m_PendingBatch };
+}
+
+void Pathfinder::ProcessRequests()
+{
+	CASS_PROFILE_SCOPE("Pathfinder::ProcessRequests");
+
+	RebuildDirtyClusters();
+
+	// Las que están en cache o repetidas en el mismo lote no se buscan
+	std::vector<uint32_t> searches;
+	std::vector<std::pair<uint32_t, uint32_t>> duplicates;
+	std::unordered_map<PathKey, uint32_t, PathKeyHash> batchKeys;
+
+	for (uint32_t i = 0; i < m_Pending.size(); i++) {
+		Request& request = m_Pending[i];
+		PathKey key{ request.Start, request.Goal };
+		m_Stats.Requests++;
+
+		auto cached = m_Cache.find(key);
+		if (cached != m_Cache.end()) {
+			m_Stats.CacheHits++;
+			request.Status = cached->second.Found ? PathStatus::Found : PathStatus::NotFound;
+			request.Waypoints = cached->second.Waypoints;
+			continue;
+		}
+
+		auto [it, inserted] = batchKeys.try_emplace(key, i);
+		if (!inserted) {
+			m_Stats.CacheHits++;
+			duplicates.push_back({ i, it->second });
+			continue;
+		}
+
+		int distance = std::max(std::abs(request.Start.x - request.Goal.x), std::abs(request.Start.y - request.Goal.y));
+		if (distance <= (int)m_ClusterSize * 2)
+			m_Stats.DirectSearches++;
+		else
+			m_Stats.HierarchicalSearches++;
+
+		searches.push_back(i);
+	}
+
+	JobSystem::ParallelFor((uint32_t)searches.size(), 8, [&](uint32_t begin, uint32_t end) {
+		SearchContext* context = AcquireContext();
+		for (uint32_t i = begin; i < end; i++) {
+			Request& request = m_Pending[searches[i]];
+			bool found = Search(request.Start, request.Goal, request.Waypoints, *context);
+			request.Status = found ? PathStatus::Found : PathStatus::NotFound;
+		}
+		ReleaseContext(context);
+	});
+
+	for (uint32_t i : searches) {
+		const Request& request = m_Pending[i];
+
+		if (m_Cache.size() >= m_CacheCapacity)
+			m_Cache.clear();
+		m_Cache[{ request.Start, request.Goal }] = { request.Status == PathStatus::Found, request.Waypoints };
+	}
+
+	for (const auto& [duplicate, original] : duplicates) {
+		m_Pending[duplicate].Status = m_Pending[original].Status;
+		m_Pending[duplicate].Waypoints = m_Pending[original].Waypoints;
+	}
+
+	m_Results = std::move(m_Pending);
+	m_Pending.clear();
+	m_ResultBatch = m_PendingBatch++;
+}
+
+PathStatus Pathfinder::GetPath(PathHandle handle, std::vector<cass::Vector2<int>>& waypoints) const
+{
+	if (handle.Batch == m_PendingBatch && handle.Index < m_Pending.size())
+		return PathStatus::Pending;
+
+	if (handle.Batch != m_ResultBatch || handle.Index >= m_Results.size())
+		return PathStatus::Invalid;
+
+	const Request& request = m_Results[handle.Index];
+	waypoints = request.Waypoints;
+	return request.Status;
+}
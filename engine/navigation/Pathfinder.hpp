@@ -0,0 +1,173 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <TileGrid.hpp>
+
+struct PathfinderParams {
+	uint32_t clusterSize = 16;       // lado de los clusters de la abstracción HPA*
+	uint32_t cacheCapacity = 4096;   // la cache se vacía al superar este número de rutas
+};
+
+enum class PathStatus : uint8_t {
+	Pending,     // pedido en este frame, aún sin ProcessRequests
+	Found,
+	NotFound,
+	Invalid      // handle de un lote anterior ya descartado
+};
+
+struct PathHandle {
+	uint32_t Index = 0xFFFFFFFF;
+	uint32_t Batch = 0;
+};
+
+struct PathfinderStats {
+	uint32_t Requests = 0;
+	uint32_t CacheHits = 0;
+	uint32_t DirectSearches = 0;       // JPS sobre los tiles
+	uint32_t HierarchicalSearches = 0; // HPA* + refinado con JPS
+	uint32_t AbstractNodes = 0;
+};
+
+// Búsqueda de caminos sobre un TileGrid, 8 direcciones sin cortar esquinas.
+//
+// Las rutas cortas se resuelven con Jump Point Search directamente sobre los
+// tiles. Las largas primero buscan sobre un grafo abstracto de entradas entre
+// clusters (HPA*) y luego refinan cada tramo con JPS, así que el coste no
+// crece con el tamaño del mapa. Las rutas HPA* son casi óptimas, no óptimas.
+//
+// El resultado son waypoints en coordenadas de tile; entre dos consecutivos
+// siempre hay una línea recta o diagonal libre.
+//
+// No es thread-safe: se llama desde un solo hilo y el trabajo se reparte
+// internamente en el JobSystem. El grid no puede cambiar durante una llamada.
+class Pathfinder {
+public:
+	Pathfinder(const TileGrid& grid, const PathfinderParams& params = {});
+	~Pathfinder();
+
+	Pathfinder(const Pathfinder&) = delete;
+	Pathfinder& operator=(const Pathfinder&) = delete;
+
+	// Avisar tras cambiar la solidez de un tile: invalida su cluster y la cache
+	void OnTileChanged(int x, int y);
+
+	// Búsqueda inmediata en el hilo actual
+	bool FindPath(cass::Vector2<int> start, cass::Vector2<int> goal, std::vector<cass::Vector2<int>>& waypoints);
+
+	// Peticiones por lotes: se acumulan durante el frame y ProcessRequests las
+	// resuelve todas en paralelo. Los resultados valen hasta el siguiente ProcessRequests.
+	PathHandle RequestPath(cass::Vector2<int> start, cass::Vector2<int> goal);
+	void ProcessRequests();
+	PathStatus GetPath(PathHandle handle, std::vector<cass::Vector2<int>>& waypoints) const;
+
+	const PathfinderStats& GetStats() const { return m_Stats; }
+
+private:
+	struct AbstractEdge {
+		uint32_t To;
+		float Cost;
+		bool Inter;     // cruza a otro cluster; si no, es un camino interno
+	};
+
+	struct AbstractNode {
+		cass::Vector2<int> Tile;
+		uint32_t Cluster = 0;
+		bool Alive = false;
+		std::vector<AbstractEdge> Edges;
+	};
+
+	struct Cluster {
+		int MinX, MinY, MaxX, MaxY;
+		std::vector<uint32_t> Nodes;
+		bool Dirty = false;
+	};
+
+	struct Request {
+		cass::Vector2<int> Start;
+		cass::Vector2<int> Goal;
+		PathStatus Status = PathStatus::Pending;
+		std::vector<cass::Vector2<int>> Waypoints;
+	};
+
+	struct CachedPath {
+		bool Found = false;
+		std::vector<cass::Vector2<int>> Waypoints;
+	};
+
+	// Petición completa como clave: sin empaquetar, así no hay colisiones en mapas grandes
+	struct PathKey {
+		cass::Vector2<int> Start;
+		cass::Vector2<int> Goal;
+
+		bool operator==(const PathKey& other) const {
+			return Start.x == other.Start.x && Start.y == other.Start.y &&
+				Goal.x == other.Goal.x && Goal.y == other.Goal.y;
+		}
+	};
+
+	struct PathKeyHash {
+		size_t operator()(const PathKey& key) const;
+	};
+
+	struct SearchContext;
+
+	bool Walkable(int x, int y) const {
+		return (uint32_t)x < m_Grid.GetWidth() && (uint32_t)y < m_Grid.GetHeight() && !m_Grid.IsSolid(x, y);
+	}
+
+	uint32_t ClusterIndex(int x, int y) const {
+		return ((uint32_t)y / m_ClusterSize) * m_ClustersX + (uint32_t)x / m_ClusterSize;
+	}
+
+	// --- Abstracción ---
+	void BuildAbstraction();
+	void RebuildDirtyClusters();
+	void BuildBorder(uint32_t cluster, bool top);
+	void ClearBorder(uint32_t cluster, bool top);
+	void BuildIntraEdges(uint32_t cluster, SearchContext& context);
+	uint32_t AddNode(cass::Vector2<int> tile);
+	void RemoveNode(uint32_t node);
+
+	// --- Búsquedas ---
+	bool Search(cass::Vector2<int> start, cass::Vector2<int> goal, std::vector<cass::Vector2<int>>& waypoints,
+		SearchContext& context) const;
+	bool JumpPointSearch(cass::Vector2<int> start, cass::Vector2<int> goal, std::vector<cass::Vector2<int>>& waypoints,
+		SearchContext& context) const;
+	bool Jump(int x, int y, int dx, int dy, cass::Vector2<int> goal, cass::Vector2<int>& jumpPoint) const;
+	bool HierarchicalSearch(cass::Vector2<int> start, cass::Vector2<int> goal, std::vector<cass::Vector2<int>>& waypoints,
+		SearchContext& context) const;
+	void ClusterDijkstra(cass::Vector2<int> source, const Cluster& cluster, SearchContext& context) const;
+
+	SearchContext* AcquireContext() const;
+	void ReleaseContext(SearchContext* context) const;
+
+	const TileGrid& m_Grid;
+	uint32_t m_ClusterSize;
+	uint32_t m_ClustersX = 0;
+	uint32_t m_ClustersY = 0;
+	uint32_t m_CacheCapacity;
+
+	std::vector<Cluster> m_Clusters;
+	std::vector<AbstractNode> m_Nodes;
+	std::vector<uint32_t> m_FreeNodes;
+	// Nodos de cada borde: [cluster * 2 + 0] = derecho, [cluster * 2 + 1] = superior
+	std::vector<std::vector<uint32_t>> m_BorderNodes;
+	bool m_AnyDirty = false;
+
+	std::unordered_map<PathKey, CachedPath, PathKeyHash> m_Cache;
+
+	std::vector<Request> m_Pending;
+	std::vector<Request> m_Results;
+	uint32_t m_PendingBatch = 1;
+	uint32_t m_ResultBatch = 0;
+
+	PathfinderStats m_Stats;
+
+	// Un contexto de búsqueda por hilo activo; se reutilizan entre lotes
+	mutable std::mutex m_ContextMutex;
+	mutable std::vector<std::unique_ptr<SearchContext>> m_Contexts;
+	mutable std::vector<SearchContext*> m_FreeContexts;
+};
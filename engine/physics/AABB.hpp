@@ -0,0 +1,47 @@
+#pragma once
+#include <algorithm>
+#include <cass_linear.hpp>
+
+// Caja alineada a los ejes en unidades de mundo
+struct AABB {
+	cass::Vector2<float> Min;
+	cass::Vector2<float> Max;
+
+	static AABB FromCenter(const cass::Vector2<float>& center, const cass::Vector2<float>& halfSize) {
+		return { center - halfSize, center + halfSize };
+	}
+
+	cass::Vector2<float> GetCenter() const { return (Min + Max) * 0.5f; }
+	cass::Vector2<float> GetSize() const { return Max - Min; }
+
+	bool Overlaps(const AABB& other) const {
+		return Min.x <= other.Max.x && Max.x >= other.Min.x &&
+			Min.y <= other.Max.y && Max.y >= other.Min.y;
+	}
+
+	bool Contains(const cass::Vector2<float>& point) const {
+		return point.x >= Min.x && point.x <= Max.x &&
+			point.y >= Min.y && point.y <= Max.y;
+	}
+
+	// Test de slabs. invDirection = 1 / dirección (puede ser inf).
+	// Devuelve el parámetro de entrada (0 si el origen ya está dentro).
+	bool Raycast(const cass::Vector2<float>& origin, const cass::Vector2<float>& invDirection,
+		float maxDistance, float& distance) const
+	{
+		float tx0 = (Min.x - origin.x) * invDirection.x;
+		float tx1 = (Max.x - origin.x) * invDirection.x;
+		float ty0 = (Min.y - origin.y) * invDirection.y;
+		float ty1 = (Max.y - origin.y) * invDirection.y;
+
+		// 0 * inf = NaN cuando el origen cae justo en el borde; min/max lo descartan
+		float tEnter = std::max({ 0.0f, std::min(tx0, tx1), std::min(ty0, ty1) });
+		float tExit = std::min({ maxDistance, std::max(tx0, tx1), std::max(ty0, ty1) });
+
+		if (tEnter > tExit)
+			return false;
+
+		distance = tEnter;
+		return true;
+	}
+};
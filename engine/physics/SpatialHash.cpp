@@ -0,0 +1,279 @@
+#include "SpatialHash.hpp"
+#include <bit>
+#include <cmath>
+#include <limits>
+
+SpatialHash::SpatialHash(const SpatialHashParams& params)
+	: m_CellSize(params.cellSize), m_InvCellSize(1.0f / params.cellSize)
+{
+	uint32_t buckets = std::bit_ceil(std::max(params.bucketCount, 1u));
+	m_BucketMask = buckets - 1;
+	m_Buckets.resize(buckets);
+}
+
+int32_t SpatialHash::CellCoord(float value) const
+{
+	return (int32_t)std::floor(value * m_InvCellSize);
+}
+
+SpatialHash::CellRange SpatialHash::ComputeRange(const AABB& bounds) const
+{
+	return {
+		CellCoord(bounds.Min.x), CellCoord(bounds.Min.y),
+		CellCoord(bounds.Max.x), CellCoord(bounds.Max.y)
+	};
+}
+
+void SpatialHash::GrowExtent(const AABB& bounds)
+{
+	if (!m_HasExtent) {
+		m_Extent = bounds;
+		m_HasExtent = true;
+		return;
+	}
+
+	m_Extent.Min = { std::min(m_Extent.Min.x, bounds.Min.x), std::min(m_Extent.Min.y, bounds.Min.y) };
+	m_Extent.Max = { std::max(m_Extent.Max.x, bounds.Max.x), std::max(m_Extent.Max.y, bounds.Max.y) };
+}
+
+uint32_t SpatialHash::BucketIndex(int32_t x, int32_t y) const
+{
+	// Primos grandes de Teschner et al. para repartir celdas vecinas
+	return ((uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u) & m_BucketMask;
+}
+
+void SpatialHash::AddToCells(uint32_t proxy, const CellRange& range)
+{
+	for (int32_t y = range.MinY; y <= range.MaxY; y++)
+		for (int32_t x = range.MinX; x <= range.MaxX; x++)
+			m_Buckets[BucketIndex(x, y)].push_back({ proxy, x, y });
+}
+
+void SpatialHash::RemoveFromCells(uint32_t proxy, const CellRange& range)
+{
+	for (int32_t y = range.MinY; y <= range.MaxY; y++) {
+		for (int32_t x = range.MinX; x <= range.MaxX; x++) {
+			std::vector<Entry>& bucket = m_Buckets[BucketIndex(x, y)];
+
+			for (size_t i = 0; i < bucket.size(); i++) {
+				if (bucket[i].Proxy == proxy && bucket[i].CellX == x && bucket[i].CellY == y) {
+					bucket[i] = bucket.back();
+					bucket.pop_back();
+					break;
+				}
+			}
+		}
+	}
+}
+
+uint32_t SpatialHash::Insert(const AABB& bounds, uint32_t userData)
+{
+	uint32_t proxy;
+
+	if (m_FreeList != InvalidProxy) {
+		proxy = m_FreeList;
+		m_FreeList = m_Proxies[proxy].NextFree;
+	}
+	else {
+		proxy = (uint32_t)m_Proxies.size();
+		m_Proxies.emplace_back();
+	}
+
+	Proxy& p = m_Proxies[proxy];
+	p.Bounds = bounds;
+	p.Cells = ComputeRange(bounds);
+	p.UserData = userData;
+	p.NextFree = InvalidProxy;
+	p.Alive = true;
+
+	AddToCells(proxy, p.Cells);
+	GrowExtent(bounds);
+	m_ProxyCount++;
+	return proxy;
+}
+
+void SpatialHash::Move(uint32_t proxy, const AABB& bounds)
+{
+	if (proxy >= m_Proxies.size() || !m_Proxies[proxy].Alive)
+		return;
+
+	Proxy& p = m_Proxies[proxy];
+	p.Bounds = bounds;
+	GrowExtent(bounds);
+
+	CellRange range = ComputeRange(bounds);
+	if (range == p.Cells)
+		return;
+
+	RemoveFromCells(proxy, p.Cells);
+	p.Cells = range;
+	AddToCells(proxy, range);
+}
+
+void SpatialHash::Remove(uint32_t proxy)
+{
+	if (proxy >= m_Proxies.size() || !m_Proxies[proxy].Alive)
+		return;
+
+	Proxy& p = m_Proxies[proxy];
+	RemoveFromCells(proxy, p.Cells);
+
+	p.Alive = false;
+	p.NextFree = m_FreeList;
+	m_FreeList = proxy;
+	m_ProxyCount--;
+}
+
+void SpatialHash::Clear()
+{
+	for (std::vector<Entry>& bucket : m_Buckets)
+		bucket.clear();
+
+	m_Proxies.clear();
+	m_FreeList = InvalidProxy;
+	m_ProxyCount = 0;
+	m_HasExtent = false;
+}
+
+void SpatialHash::Query(const AABB& area, std::vector<uint32_t>& out) const
+{
+	CellRange range = ComputeRange(area);
+	uint64_t cellCount = (uint64_t)(range.MaxX - range.MinX + 1) * (uint64_t)(range.MaxY - range.MinY + 1);
+
+	// Un área que cubre más celdas que buckets sale más barata recorriendo los proxies
+	if (cellCount > m_Buckets.size()) {
+		for (const Proxy& p : m_Proxies)
+			if (p.Alive && p.Bounds.Overlaps(area))
+				out.push_back(p.UserData);
+		return;
+	}
+
+	for (int32_t y = range.MinY; y <= range.MaxY; y++) {
+		for (int32_t x = range.MinX; x <= range.MaxX; x++) {
+			for (const Entry& entry : m_Buckets[BucketIndex(x, y)]) {
+				if (entry.CellX != x || entry.CellY != y)
+					continue;
+
+				const AABB& bounds = m_Proxies[entry.Proxy].Bounds;
+				if (!bounds.Overlaps(area))
+					continue;
+
+				// Un proxy que ocupa varias celdas solo se reporta desde la celda
+				// que contiene la esquina mínima de la intersección
+				if (CellCoord(std::max(bounds.Min.x, area.Min.x)) != x ||
+					CellCoord(std::max(bounds.Min.y, area.Min.y)) != y)
+					continue;
+
+				out.push_back(m_Proxies[entry.Proxy].UserData);
+			}
+		}
+	}
+}
+
+bool SpatialHash::Raycast(const cass::Vector2<float>& origin, const cass::Vector2<float>& direction,
+	float maxDistance, SpatialRayHit& hit) const
+{
+	constexpr float Inf = std::numeric_limits<float>::infinity();
+
+	if (!std::isfinite(maxDistance) || maxDistance < 0 || !m_HasExtent || m_ProxyCount == 0)
+		return false;
+
+	cass::Vector2<float> invDirection(
+		direction.x != 0 ? 1.0f / direction.x : Inf,
+		direction.y != 0 ? 1.0f / direction.y : Inf);
+
+	// El recorrido empieza donde el rayo entra en la caja de todo lo insertado
+	// y termina donde sale: fuera no hay nada que encontrar
+	float tStart;
+	if (!m_Extent.Raycast(origin, invDirection, maxDistance, tStart))
+		return false;
+
+	float tx0 = (m_Extent.Min.x - origin.x) * invDirection.x;
+	float tx1 = (m_Extent.Max.x - origin.x) * invDirection.x;
+	float ty0 = (m_Extent.Min.y - origin.y) * invDirection.y;
+	float ty1 = (m_Extent.Max.y - origin.y) * invDirection.y;
+	float tEnd = std::min({ maxDistance, std::max(tx0, tx1), std::max(ty0, ty1) });
+
+	// Con un eje de dirección 0 el slab da NaN o inf; min descarta el NaN y
+	// maxDistance (finito) acota el resto
+	if (!(tEnd >= tStart))
+		tEnd = maxDistance;
+
+	cass::Vector2<float> start(origin.x + direction.x * tStart, origin.y + direction.y * tStart);
+
+	// Recorrido de celdas de Amanatides & Woo
+	int32_t x = CellCoord(start.x);
+	int32_t y = CellCoord(start.y);
+	int32_t stepX = direction.x > 0 ? 1 : -1;
+	int32_t stepY = direction.y > 0 ? 1 : -1;
+
+	float tDeltaX = direction.x != 0 ? m_CellSize * std::abs(invDirection.x) : Inf;
+	float tDeltaY = direction.y != 0 ? m_CellSize * std::abs(invDirection.y) : Inf;
+	float tMaxX = direction.x != 0 ? tStart + ((x + (stepX > 0 ? 1 : 0)) * m_CellSize - start.x) * invDirection.x : Inf;
+	float tMaxY = direction.y != 0 ? tStart + ((y + (stepY > 0 ? 1 : 0)) * m_CellSize - start.y) * invDirection.y : Inf;
+
+	bool found = false;
+	float best = maxDistance;
+
+	while (true) {
+		for (const Entry& entry : m_Buckets[BucketIndex(x, y)]) {
+			if (entry.CellX != x || entry.CellY != y)
+				continue;
+
+			float distance;
+			if (m_Proxies[entry.Proxy].Bounds.Raycast(origin, invDirection, best, distance) &&
+				(!found || distance < hit.Distance)) {
+				hit.UserData = m_Proxies[entry.Proxy].UserData;
+				hit.Distance = distance;
+				best = distance;
+				found = true;
+			}
+		}
+
+		float tCellExit = std::min(tMaxX, tMaxY);
+
+		// Nada en celdas posteriores puede estar más cerca que lo ya encontrado
+		if (found && hit.Distance <= tCellExit)
+			return true;
+		if (!(tCellExit < tEnd))
+			break;
+
+		if (tMaxX < tMaxY) {
+			x += stepX;
+			tMaxX += tDeltaX;
+		}
+		else {
+			y += stepY;
+			tMaxY += tDeltaY;
+		}
+	}
+
+	return found;
+}
+
+void SpatialHash::ComputePairs(std::vector<SpatialPair>& out) const
+{
+	for (const std::vector<Entry>& bucket : m_Buckets) {
+		for (size_t i = 0; i < bucket.size(); i++) {
+			const Entry& a = bucket[i];
+			const AABB& boundsA = m_Proxies[a.Proxy].Bounds;
+
+			for (size_t j = i + 1; j < bucket.size(); j++) {
+				const Entry& b = bucket[j];
+				if (a.CellX != b.CellX || a.CellY != b.CellY)
+					continue;
+
+				const AABB& boundsB = m_Proxies[b.Proxy].Bounds;
+				if (!boundsA.Overlaps(boundsB))
+					continue;
+
+				// Misma regla que Query: el par se reporta solo en una de las celdas compartidas
+				if (CellCoord(std::max(boundsA.Min.x, boundsB.Min.x)) != a.CellX ||
+					CellCoord(std::max(boundsA.Min.y, boundsB.Min.y)) != a.CellY)
+					continue;
+
+				out.push_back({ m_Proxies[a.Proxy].UserData, m_Proxies[b.Proxy].UserData });
+			}
+		}
+	}
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "AABB.hpp"
+
+struct SpatialHashParams {
+	float cellSize = 4.0f;        // idealmente ~2x el tamaño típico de los objetos
+	uint32_t bucketCount = 4096;  // se redondea a potencia de 2
+};
+
+struct SpatialPair {
+	uint32_t A;
+	uint32_t B;
+};
+
+struct SpatialRayHit {
+	uint32_t UserData = 0;
+	float Distance = 0;
+};
+
+// Broad-phase para AABBs dinámicas. Cada proxy se registra en todas las celdas
+// que toca; las celdas se reparten en un número fijo de buckets por hash, así
+// que el mundo no tiene límites. Move solo toca los buckets si la caja cambia
+// de rango de celdas.
+//
+// Las consultas son const y no guardan estado: se pueden lanzar desde varios
+// hilos a la vez mientras nadie inserte, mueva o borre.
+class SpatialHash {
+public:
+	static constexpr uint32_t InvalidProxy = 0xFFFFFFFF;
+
+	SpatialHash(const SpatialHashParams& params = {});
+
+	uint32_t Insert(const AABB& bounds, uint32_t userData);
+	void Move(uint32_t proxy, const AABB& bounds);
+	void Remove(uint32_t proxy);
+	void Clear();
+
+	const AABB& GetBounds(uint32_t proxy) const { return m_Proxies[proxy].Bounds; }
+	uint32_t GetUserData(uint32_t proxy) const { return m_Proxies[proxy].UserData; }
+	uint32_t GetProxyCount() const { return m_ProxyCount; }
+
+	// Caja que cubre todo lo que se ha insertado o movido desde el último Clear (no se encoge)
+	const AABB& GetExtent() const { return m_Extent; }
+
+	// Añade a out el UserData de cada proxy que solapa con area (sin duplicados)
+	void Query(const AABB& area, std::vector<uint32_t>& out) const;
+
+	// Proxy más cercano que corta el rayo origin + direction * t, t en [0, maxDistance].
+	// maxDistance tiene que ser finito; el recorrido no sale de la caja que
+	// cubre todo lo insertado (Extent).
+	bool Raycast(const cass::Vector2<float>& origin, const cass::Vector2<float>& direction,
+		float maxDistance, SpatialRayHit& hit) const;
+
+	// Todos los pares de proxies que se solapan, cada par una sola vez
+	void ComputePairs(std::vector<SpatialPair>& out) const;
+
+private:
+	struct CellRange {
+		int32_t MinX, MinY, MaxX, MaxY;
+		bool operator==(const CellRange& other) const = default;
+	};
+
+	struct Proxy {
+		AABB Bounds;
+		CellRange Cells;
+		uint32_t UserData = 0;
+		uint32_t NextFree = InvalidProxy;
+		bool Alive = false;
+	};
+
+	// La celda va en la entrada porque varias celdas pueden compartir bucket
+	struct Entry {
+		uint32_t Proxy;
+		int32_t CellX;
+		int32_t CellY;
+	};
+
+	void GrowExtent(const AABB& bounds);
+
+	int32_t CellCoord(float value) const;
+	CellRange ComputeRange(const AABB& bounds) const;
+	uint32_t BucketIndex(int32_t x, int32_t y) const;
+
+	void AddToCells(uint32_t proxy, const CellRange& range);
+	void RemoveFromCells(uint32_t proxy, const CellRange& range);
+
+	float m_CellSize;
+	float m_InvCellSize;
+	uint32_t m_BucketMask;
+
+	std::vector<std::vector<Entry>> m_Buckets;
+	std::vector<Proxy> m_Proxies;
+	uint32_t m_FreeList = InvalidProxy;
+	uint32_t m_ProxyCount = 0;
+
+	AABB m_Extent = { { 0, 0 }, { 0, 0 } };
+	bool m_HasExtent = false;
+};
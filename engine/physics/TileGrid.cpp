@@ -0,0 +1,322 @@
+#include "TileGrid.hpp"
+#include <bit>
+#include <cmath>
+#include <limits>
+
+TileGrid::TileGrid(uint32_t width, uint32_t height)
+{
+	Resize(width, height);
+}
+
+void TileGrid::Resize(uint32_t width, uint32_t height)
+{
+	m_Width = width;
+	m_Height = height;
+	m_RowWords = (width + 63) / 64;
+	m_Bits.assign((size_t)m_RowWords * height, 0);
+
+	if (!m_Distance.empty())
+		m_Distance.assign((size_t)width * height, m_MaxDistance);
+}
+
+void TileGrid::SetSolid(int x, int y, bool solid)
+{
+	if ((uint32_t)x >= m_Width || (uint32_t)y >= m_Height)
+		return;
+
+	uint64_t& word = m_Bits[(size_t)y * m_RowWords + ((uint32_t)x >> 6)];
+	uint64_t bit = uint64_t(1) << (x & 63);
+
+	if (((word & bit) != 0) == solid)
+		return;
+
+	if (solid)
+		word |= bit;
+	else
+		word &= ~bit;
+
+	// Las celdas fuera de esta ventana no se ven afectadas por el cambio
+	if (!m_Distance.empty())
+		UpdateDistance(x - m_MaxDistance, y - m_MaxDistance, x + m_MaxDistance, y + m_MaxDistance);
+}
+
+void TileGrid::EnableDistanceField(uint8_t maxDistance)
+{
+	m_MaxDistance = std::max<uint8_t>(maxDistance, 1);
+	m_Distance.assign((size_t)m_Width * m_Height, m_MaxDistance);
+	UpdateDistance(0, 0, (int)m_Width - 1, (int)m_Height - 1);
+}
+
+void TileGrid::UpdateDistance(int x0, int y0, int x1, int y1)
+{
+	x0 = std::max(x0, 0);
+	y0 = std::max(y0, 0);
+	x1 = std::min(x1, (int)m_Width - 1);
+	y1 = std::min(y1, (int)m_Height - 1);
+
+	// Los vecinos fuera de la ventana se leen tal cual; fuera de la rejilla no hay sólidos
+	auto at = [&](int x, int y) -> uint8_t {
+		if ((uint32_t)x >= m_Width || (uint32_t)y >= m_Height)
+			return m_MaxDistance;
+		return m_Distance[(size_t)y * m_Width + x];
+	};
+
+	for (int y = y0; y <= y1; y++)
+		for (int x = x0; x <= x1; x++)
+			m_Distance[(size_t)y * m_Width + x] = IsSolid(x, y) ? 0 : m_MaxDistance;
+
+	// Dos pasadas con la máscara de 8 vecinos (exacto para Chebyshev)
+	for (int y = y0; y <= y1; y++) {
+		for (int x = x0; x <= x1; x++) {
+			uint8_t& d = m_Distance[(size_t)y * m_Width + x];
+			int best = std::min({ (int)at(x - 1, y), (int)at(x - 1, y - 1), (int)at(x, y - 1), (int)at(x + 1, y - 1) }) + 1;
+			if (best < d)
+				d = (uint8_t)best;
+		}
+	}
+
+	for (int y = y1; y >= y0; y--) {
+		for (int x = x1; x >= x0; x--) {
+			uint8_t& d = m_Distance[(size_t)y * m_Width + x];
+			int best = std::min({ (int)at(x + 1, y), (int)at(x + 1, y + 1), (int)at(x, y + 1), (int)at(x - 1, y + 1) }) + 1;
+			if (best < d)
+				d = (uint8_t)best;
+		}
+	}
+}
+
+int TileGrid::FindSolidInRow(int y, int x0, int x1) const
+{
+	if ((uint32_t)y >= m_Height)
+		return -1;
+
+	x0 = std::max(x0, 0);
+	x1 = std::min(x1, (int)m_Width - 1);
+	if (x0 > x1)
+		return -1;
+
+	const uint64_t* row = &m_Bits[(size_t)y * m_RowWords];
+	uint32_t first = (uint32_t)x0 >> 6;
+	uint32_t last = (uint32_t)x1 >> 6;
+
+	for (uint32_t w = first; w <= last; w++) {
+		uint64_t bits = row[w];
+
+		if (w == first)
+			bits &= ~uint64_t(0) << (x0 & 63);
+		if (w == last && (x1 & 63) != 63)
+			bits &= (uint64_t(1) << ((x1 & 63) + 1)) - 1;
+
+		if (bits)
+			return (int)(w * 64 + std::countr_zero(bits));
+	}
+
+	return -1;
+}
+
+// Tiles que ocupa el intervalo [min, max]; tocar un borde no cuenta como ocupar
+static void TileSpan(float min, float max, int& first, int& last)
+{
+	first = (int)std::floor(min);
+	last = (int)std::ceil(max) - 1;
+	if (last < first)
+		last = first;
+}
+
+// Distancia a un borde de tile por debajo de la cual se considera que se está
+// en él. Tras deslizar, el eje libre puede quedar un ulp dentro de una fila en
+// vez de justo en el borde: con el margen esa fila aún cuenta como por entrar
+static constexpr float EdgeEpsilon = TileGrid::Skin * 0.5f;
+
+// Si el borde delantero edge (que avanza hacia step) está sobre un borde de
+// tile, devuelve en cell la fila o columna que hay al otro lado
+static bool OnTileBoundary(float edge, int step, int& cell)
+{
+	float boundary = std::round(edge);
+	if (std::abs(edge - boundary) > EdgeEpsilon)
+		return false;
+
+	cell = step > 0 ? (int)boundary : (int)boundary - 1;
+	return true;
+}
+
+TileSweepResult TileGrid::Sweep(const AABB& box, const cass::Vector2<float>& delta) const
+{
+	constexpr float Inf = std::numeric_limits<float>::infinity();
+	TileSweepResult result;
+
+	// Siguiente columna/fila en la que entra el borde delantero y cuándo (t en [0, 1])
+	int stepX = delta.x > 0 ? 1 : -1;
+	int stepY = delta.y > 0 ? 1 : -1;
+	int column = 0, row = 0;
+	float tX = Inf, tY = Inf;
+	float tDeltaX = Inf, tDeltaY = Inf;
+
+	if (delta.x > 0) {
+		float boundary = std::ceil(box.Max.x - EdgeEpsilon);
+		column = (int)boundary;
+		tX = std::max(0.0f, (boundary - box.Max.x) / delta.x);
+		tDeltaX = 1.0f / delta.x;
+	}
+	else if (delta.x < 0) {
+		float boundary = std::floor(box.Min.x + EdgeEpsilon);
+		column = (int)boundary - 1;
+		tX = std::max(0.0f, (boundary - box.Min.x) / delta.x);
+		tDeltaX = -1.0f / delta.x;
+	}
+
+	if (delta.y > 0) {
+		float boundary = std::ceil(box.Max.y - EdgeEpsilon);
+		row = (int)boundary;
+		tY = std::max(0.0f, (boundary - box.Max.y) / delta.y);
+		tDeltaY = 1.0f / delta.y;
+	}
+	else if (delta.y < 0) {
+		float boundary = std::floor(box.Min.y + EdgeEpsilon);
+		row = (int)boundary - 1;
+		tY = std::max(0.0f, (boundary - box.Min.y) / delta.y);
+		tDeltaY = -1.0f / delta.y;
+	}
+
+	while (true) {
+		// Al salir de la rejilla ya no queda nada contra lo que chocar en ese eje
+		if ((stepX > 0 && column >= (int)m_Width) || (stepX < 0 && column < 0))
+			tX = Inf;
+		if ((stepY > 0 && row >= (int)m_Height) || (stepY < 0 && row < 0))
+			tY = Inf;
+
+		float t = std::min(tX, tY);
+		if (t > 1.0f)
+			break;
+
+		if (tX <= tY) {
+			int bottom, top;
+			TileSpan(box.Min.y + delta.y * t, box.Max.y + delta.y * t, bottom, top);
+			bottom = std::max(bottom, 0);
+			top = std::min(top, (int)m_Height - 1);
+
+			for (int y = bottom; y <= top; y++) {
+				if (IsSolid(column, y)) {
+					result.Hit = true;
+					result.Time = t;
+					result.Normal = { -stepX, 0 };
+					result.Tile = { column, y };
+					return result;
+				}
+			}
+
+			// Si la esquina entra a la vez (o casi) en columna y fila, el tile de
+			// la esquina no está en el tramo de ninguno de los dos ejes. Se trata
+			// como contacto en Y: sobre un borde se aterriza en vez de resbalar
+			int cornerRow;
+			float edgeY = (stepY > 0 ? box.Max.y : box.Min.y) + delta.y * t;
+			if (delta.y != 0 && OnTileBoundary(edgeY, stepY, cornerRow) && IsSolid(column, cornerRow)) {
+				result.Hit = true;
+				result.Time = t;
+				result.Normal = { 0, -stepY };
+				result.Tile = { column, cornerRow };
+				return result;
+			}
+
+			column += stepX;
+			tX += tDeltaX;
+		}
+		else {
+			int left, right;
+			TileSpan(box.Min.x + delta.x * t, box.Max.x + delta.x * t, left, right);
+
+			int x = FindSolidInRow(row, left, right);
+
+			// Lo mismo que en X, con la columna de la esquina
+			int cornerColumn;
+			float edgeX = (stepX > 0 ? box.Max.x : box.Min.x) + delta.x * t;
+			if (x < 0 && delta.x != 0 && OnTileBoundary(edgeX, stepX, cornerColumn) && IsSolid(cornerColumn, row))
+				x = cornerColumn;
+
+			if (x >= 0) {
+				result.Hit = true;
+				result.Time = t;
+				result.Normal = { 0, -stepY };
+				result.Tile = { x, row };
+				return result;
+			}
+
+			row += stepY;
+			tY += tDeltaY;
+		}
+	}
+
+	return result;
+}
+
+TileMoveResult TileGrid::Move(const AABB& box, const cass::Vector2<float>& delta) const
+{
+	TileMoveResult result{ box };
+	cass::Vector2<float> remaining = delta;
+
+	// Camino rápido, el caso de casi todos los frames: si en la caja barrida
+	// (con el margen de los bordes) no hay ningún sólido, no hay contacto posible
+	int bottom = (int)std::floor(std::min(box.Min.y, box.Min.y + delta.y) - EdgeEpsilon);
+	int top = (int)std::floor(std::max(box.Max.y, box.Max.y + delta.y) + EdgeEpsilon);
+	int left = (int)std::floor(std::min(box.Min.x, box.Min.x + delta.x) - EdgeEpsilon);
+	int right = (int)std::floor(std::max(box.Max.x, box.Max.x + delta.x) + EdgeEpsilon);
+
+	bool clear = top - bottom <= 2;
+	for (int y = bottom; clear && y <= top; y++)
+		clear = FindSolidInRow(y, left, right) < 0;
+
+	if (clear) {
+		result.Bounds.Min += delta;
+		result.Bounds.Max += delta;
+		return result;
+	}
+
+	// Como mucho un contacto por eje más uno de esquina
+	for (int i = 0; i < 3 && (remaining.x != 0 || remaining.y != 0); i++) {
+		TileSweepResult sweep = Sweep(result.Bounds, remaining);
+
+		if (!sweep.Hit) {
+			result.Bounds.Min += remaining;
+			result.Bounds.Max += remaining;
+			break;
+		}
+
+		cass::Vector2<float> step = remaining * sweep.Time;
+		result.Bounds.Min += step;
+		result.Bounds.Max += step;
+
+		// Se ajusta el eje bloqueado a la pared exacta (menos Skin) y se
+		// desliza con lo que queda del otro eje
+		float shift = 0;
+		if (sweep.Normal.x < 0) {
+			shift = (sweep.Tile.x - Skin) - result.Bounds.Max.x;
+			result.Contacts |= TileContactRight;
+		}
+		else if (sweep.Normal.x > 0) {
+			shift = (sweep.Tile.x + 1 + Skin) - result.Bounds.Min.x;
+			result.Contacts |= TileContactLeft;
+		}
+		result.Bounds.Min.x += shift;
+		result.Bounds.Max.x += shift;
+
+		shift = 0;
+		if (sweep.Normal.y < 0) {
+			shift = (sweep.Tile.y - Skin) - result.Bounds.Max.y;
+			result.Contacts |= TileContactTop;
+		}
+		else if (sweep.Normal.y > 0) {
+			shift = (sweep.Tile.y + 1 + Skin) - result.Bounds.Min.y;
+			result.Contacts |= TileContactBottom;
+		}
+		result.Bounds.Min.y += shift;
+		result.Bounds.Max.y += shift;
+
+		remaining = remaining * (1.0f - sweep.Time);
+		if (sweep.Normal.x != 0)
+			remaining.x = 0;
+		else
+			remaining.y = 0;
+	}
+
+	return result;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "AABB.hpp"
+
+// Bits de TileMoveResult::Contacts
+enum TileContact : uint8_t {
+	TileContactNone = 0,
+	TileContactLeft = 1 << 0,
+	TileContactRight = 1 << 1,
+	TileContactBottom = 1 << 2,
+	TileContactTop = 1 << 3
+};
+
+struct TileSweepResult {
+	bool Hit = false;
+	float Time = 1.0f;                 // fracción de delta recorrida antes del contacto
+	cass::Vector2<int> Normal;         // apunta fuera del tile golpeado
+	cass::Vector2<int> Tile;
+};
+
+struct TileMoveResult {
+	AABB Bounds;
+	uint8_t Contacts = TileContactNone;
+};
+
+// Rejilla de solidez de 1 bit por tile, fila a fila con y hacia arriba
+// (la fila 0 es la de abajo, igual que las coordenadas de mundo).
+// Fuera de la rejilla todo es vacío.
+class TileGrid {
+public:
+	// Separación que se deja entre la caja y la pared tras un contacto
+	static constexpr float Skin = 0.001f;
+
+	TileGrid() = default;
+	TileGrid(uint32_t width, uint32_t height);
+
+	void Resize(uint32_t width, uint32_t height);
+
+	uint32_t GetWidth() const { return m_Width; }
+	uint32_t GetHeight() const { return m_Height; }
+
+	void SetSolid(int x, int y, bool solid);
+
+	bool IsSolid(int x, int y) const {
+		if ((uint32_t)x >= m_Width || (uint32_t)y >= m_Height)
+			return false;
+		return (m_Bits[(size_t)y * m_RowWords + ((uint32_t)x >> 6)] >> (x & 63)) & 1;
+	}
+
+	// Distancia (Chebyshev, en tiles) al sólido más cercano: 0 en un sólido,
+	// 1 junto a uno, y así hasta maxDistance. Se mantiene al día en SetSolid
+	// recalculando solo la ventana de radio maxDistance alrededor del cambio.
+	void EnableDistanceField(uint8_t maxDistance = 16);
+
+	uint8_t GetDistance(int x, int y) const {
+		if ((uint32_t)x >= m_Width || (uint32_t)y >= m_Height || m_Distance.empty())
+			return m_MaxDistance;
+		return m_Distance[(size_t)y * m_Width + x];
+	}
+
+	// Primera columna sólida de la fila y entre x0 y x1 (inclusive), o -1.
+	// Recorre palabras de 64 tiles en vez de tile a tile.
+	int FindSolidInRow(int y, int x0, int x1) const;
+
+	// Primer contacto de box desplazándose delta, recorriendo solo las
+	// filas/columnas que cruza su borde delantero. No depende de la velocidad.
+	TileSweepResult Sweep(const AABB& box, const cass::Vector2<float>& delta) const;
+
+	// Mueve box deslizándose contra las paredes
+	TileMoveResult Move(const AABB& box, const cass::Vector2<float>& delta) const;
+
+private:
+	uint32_t m_Width = 0;
+	uint32_t m_Height = 0;
+	uint32_t m_RowWords = 0;
+	std::vector<uint64_t> m_Bits;
+
+	uint8_t m_MaxDistance = 0;
+	std::vector<uint8_t> m_Distance;
+
+	void UpdateDistance(int x0, int y0, int x1, int y1);
+};
@@ -0,0 +1,97 @@
+#include "Framebuffer.hpp"
+#include <iostream>
+
+std::vector<RenderTargetPool::Entry> RenderTargetPool::s_Entries;
+
+Framebuffer::Framebuffer(const FramebufferParams& params)
+	: m_Params(params)
+{
+	uint32_t color;
+	glCreateTextures(GL_TEXTURE_2D, 1, &color);
+	glTextureStorage2D(color, 1, params.ColorFormat, params.Width, params.Height);
+	glTextureParameteri(color, GL_TEXTURE_MIN_FILTER, params.Filter);
+	glTextureParameteri(color, GL_TEXTURE_MAG_FILTER, params.Filter);
+	glTextureParameteri(color, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTextureParameteri(color, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	// La textura es dueña del id: se borra con ella
+	m_Color.reset(new Texture2D(color, params.Width, params.Height));
+
+	glCreateFramebuffers(1, &m_RendererID);
+	glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0, color, 0);
+
+	if (params.Depth) {
+		glCreateRenderbuffers(1, &m_DepthID);
+		glNamedRenderbufferStorage(m_DepthID, GL_DEPTH_COMPONENT24, params.Width, params.Height);
+		glNamedFramebufferRenderbuffer(m_RendererID, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_DepthID);
+	}
+
+	if (glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		std::cerr << "Framebuffer " << params.Width << "x" << params.Height << " is incomplete\n";
+}
+
+Framebuffer::~Framebuffer()
+{
+	glDeleteFramebuffers(1, &m_RendererID);
+	if (m_DepthID)
+		glDeleteRenderbuffers(1, &m_DepthID);
+}
+
+void Framebuffer::Bind()
+{
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &m_PreviousFramebuffer);
+	glGetIntegerv(GL_VIEWPORT, m_PreviousViewport);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+	glViewport(0, 0, m_Params.Width, m_Params.Height);
+}
+
+void Framebuffer::Unbind()
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, m_PreviousFramebuffer);
+	glViewport(m_PreviousViewport[0], m_PreviousViewport[1], m_PreviousViewport[2], m_PreviousViewport[3]);
+}
+
+Framebuffer* RenderTargetPool::Acquire(const FramebufferParams& params)
+{
+	for (Entry& entry : s_Entries) {
+		if (!entry.InUse && entry.Target->GetParams() == params) {
+			entry.InUse = true;
+			entry.IdleFrames = 0;
+			return entry.Target.get();
+		}
+	}
+
+	s_Entries.push_back({ std::make_unique<Framebuffer>(params), true, 0 });
+	return s_Entries.back().Target.get();
+}
+
+void RenderTargetPool::Release(Framebuffer* framebuffer)
+{
+	for (Entry& entry : s_Entries) {
+		if (entry.Target.get() == framebuffer) {
+			entry.InUse = false;
+			return;
+		}
+	}
+}
+
+void RenderTargetPool::NewFrame(uint32_t maxIdleFrames)
+{
+	for (size_t i = 0; i < s_Entries.size();) {
+		Entry& entry = s_Entries[i];
+
+		if (!entry.InUse && ++entry.IdleFrames > maxIdleFrames) {
+			s_Entries[i] = std::move(s_Entries.back());
+			s_Entries.pop_back();
+			continue;
+		}
+
+		i++;
+	}
+}
+
+void RenderTargetPool::Clear()
+{
+	s_Entries.clear();
+}
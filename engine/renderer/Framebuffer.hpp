@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glad/glad.h>
+#include "Texture2D.hpp"
+
+struct FramebufferParams {
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	GLenum ColorFormat = GL_RGBA8;
+	GLint Filter = GL_NEAREST;      // al componer el resultado escalado
+	bool Depth = false;             // añade un depth buffer (renderbuffer)
+
+	bool operator==(const FramebufferParams& other) const {
+		return Width == other.Width && Height == other.Height && ColorFormat == other.ColorFormat
+			&& Filter == other.Filter && Depth == other.Depth;
+	}
+};
+
+// Destino de render con una textura de color. Se dibuja en él con el
+// Renderer2D de siempre entre Bind() y Unbind() y luego su textura se
+// compone como cualquier otro sprite.
+class Framebuffer {
+public:
+	Framebuffer(const FramebufferParams& params);
+	~Framebuffer();
+
+	Framebuffer(const Framebuffer&) = delete;
+	Framebuffer& operator=(const Framebuffer&) = delete;
+
+	// Ajusta el viewport a su tamaño y guarda el framebuffer/viewport anterior
+	void Bind();
+	// Vuelve al framebuffer y viewport que había antes de Bind()
+	void Unbind();
+
+	Texture2D* GetColorAttachment() const { return m_Color.get(); }
+	uint32_t GetRendererID() const { return m_RendererID; }
+	const FramebufferParams& GetParams() const { return m_Params; }
+	uint32_t GetWidth() const { return m_Params.Width; }
+	uint32_t GetHeight() const { return m_Params.Height; }
+
+private:
+	FramebufferParams m_Params;
+	uint32_t m_RendererID = 0;
+	uint32_t m_DepthID = 0;
+	std::unique_ptr<Texture2D> m_Color;
+
+	int m_PreviousFramebuffer = 0;
+	int m_PreviousViewport[4] = {};
+};
+
+// Reutiliza framebuffers por tamaño y formato en vez de crearlos y
+// destruirlos cada frame. Los que llevan varios frames sin pedirse se liberan.
+class RenderTargetPool {
+public:
+	static Framebuffer* Acquire(const FramebufferParams& params);
+	static void Release(Framebuffer* framebuffer);
+
+	// Una vez por frame; destruye los libres que llevan maxIdleFrames sin usarse
+	static void NewFrame(uint32_t maxIdleFrames = 60);
+	// Destruye todos (antes de perder el contexto de OpenGL)
+	static void Clear();
+
+	static uint32_t GetCount() { return (uint32_t)s_Entries.size(); }
+
+private:
+	struct Entry {
+		std::unique_ptr<Framebuffer> Target;
+		bool InUse = false;
+		uint32_t IdleFrames = 0;
+	};
+
+	static std::vector<Entry> s_Entries;
+};
@@ -23,3 +23,14 @@ void Renderer::SetClearColor(const uint32_t argb) {
 	float b = (argb & 0xFF) / 255.0f;
     glClearColor(r, g, b, a);
 }
+
+void Renderer::Clear(const uint32_t argb)
+{
+	float previous[4];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, previous);
+
+	SetClearColor(argb);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	glClearColor(previous[0], previous[1], previous[2], previous[3]);
+}
@@ -9,4 +9,6 @@ public:
     static void EndFrame();
 
     static void SetClearColor(const uint32_t argb);
+    // Limpia el destino actual (ventana o Framebuffer) con su propio color
+    static void Clear(const uint32_t argb);
 };
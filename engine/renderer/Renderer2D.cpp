@@ -3,13 +3,24 @@
 #include <array>
 #include <vector>
 #include "FontManager.hpp"
+#include "Framebuffer.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
 
 struct QuadVertex {
 	cass::Vector3<float> Position;
 	uint32_t ColorARGB;
-	cass::Vector2<float> TexCoords;
-	float TexIndex = 0;
-	float ShapeType = 0;
+	uint16_t TexCoords[2];   // normalizados: 0..65535 -> 0..1
+	uint8_t TexIndex = 0;
+	uint8_t ShapeType = 0;
+};
+
+// Quad guardado en el modo por capas hasta EndScene. TexIndex se asigna al emitirlo.
+struct LayeredQuad {
+	QuadVertex Vertices[4];
+	Texture2D* Texture;
+	float Z;
 };
 
 struct Renderer2DData {
@@ -25,12 +36,39 @@ struct Renderer2DData {
 	uint32_t Shader = 0;
 
 	int ViewProjectionLocation = -1;
+	int AlphaCutoffLocation = -1;
+	int DebugModeLocation = -1;
+	int DebugTintLocation = -1;
+
+	Renderer2DDebugMode DebugMode = Renderer2DDebugMode::None;
+	std::vector<FlushRecord> FlushLog;
 
 	uint32_t IndexCount = 0;
 	std::array<Texture2D*, MaxTextureSlots> TextureSlots;
 	uint32_t TextureSlotIndex = 1;
 
 	Renderer2DStats Stats;
+
+	// Sin escena no se descarta nada
+	cass::Vector4<float> VisibleRect = { -FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX };
+
+	Framebuffer* PixelTarget = nullptr;
+	PixelPerfectParams PixelParams;
+
+	bool Layered = false;
+	std::vector<LayeredQuad> OpaqueQuads;
+	std::vector<LayeredQuad> TranslucentQuads;
+	std::vector<Texture2D*> LayerTextures;   // TexIndex provisional -> textura
+	std::vector<uint32_t> LayerOrder;
+
+	std::vector<GlyphQuad> TextQuads;        // DrawText maqueta aquí cada llamada
+
+	// Un par (samples, tiempo) por escena; se leen cuando la GPU los tiene listos
+	static const uint32_t MaxSceneQueries = 8;
+	uint32_t SceneQueries[MaxSceneQueries][2] = {};
+	bool QueryPending[MaxSceneQueries] = {};
+	uint32_t NextQuery = 0;
+	int ActiveQuery = -1;
 };
 
 static Renderer2DData s_Data;
@@ -97,11 +135,21 @@ static uint32_t CreateShader() {
 		out vec4 FragColor;
 
 		uniform sampler2D u_Textures[16];
+		uniform float u_AlphaCutoff;   // modo por capas: 0.5 en la pasada opaca; -1 = nunca descarta
+		uniform int u_DebugMode;       // 0 = normal, 1 = overdraw (blending aditivo), 2 = tinte por batch
+		uniform vec3 u_DebugTint;
 
 		void main() { 
 			vec4 texColor = texture(u_Textures[int(v_TexIndex)], v_TexCoord);
 
-			if (v_ShapeType > 1.5) {
+			if (v_ShapeType > 2.5) {
+				// texto SDF: 0.5 es el contorno, fwidth mantiene el borde nítido a cualquier escala
+				float dist = texColor.r;
+				float width = max(fwidth(dist), 1e-4);
+				float alpha = smoothstep(0.5 - width, 0.5 + width, dist);
+				FragColor = vec4(v_Color.rgb, v_Color.a * alpha);
+
+			} else if (v_ShapeType > 1.5) {
 				// círculo
 				vec2 coord = v_TexCoord * 2.0 - 1.0;
 				float dist = length(coord);
@@ -118,6 +166,18 @@ static uint32_t CreateShader() {
 				// sprite normal RGBA
 				FragColor = texColor * v_Color;
 			}
+
+			if (FragColor.a <= u_AlphaCutoff)
+				discard;
+
+			if (u_DebugMode == 1) {
+				if (FragColor.a <= 0.0)
+					discard;
+				// el rojo satura a las 10 capas y el verde a las 20
+				FragColor = vec4(0.1, 0.05, 0.025, 1.0);
+			} else if (u_DebugMode == 2) {
+				FragColor.rgb = mix(FragColor.rgb, u_DebugTint, 0.75);
+			}
 		}
     )";
 
@@ -143,6 +203,37 @@ const Renderer2DStats& Renderer2D::GetStats()
 void Renderer2D::ResetStats()
 {
 	s_Data.Stats = {};
+	s_Data.FlushLog.clear();
+}
+
+void Renderer2D::SetDebugMode(Renderer2DDebugMode mode)
+{
+	s_Data.DebugMode = mode;
+
+	int shaderMode = mode == Renderer2DDebugMode::None ? 0 : (mode == Renderer2DDebugMode::Overdraw ? 1 : 2);
+	glProgramUniform1i(s_Data.Shader, s_Data.DebugModeLocation, shaderMode);
+}
+
+Renderer2DDebugMode Renderer2D::GetDebugMode()
+{
+	return s_Data.DebugMode;
+}
+
+const std::vector<FlushRecord>& Renderer2D::GetFlushLog()
+{
+	return s_Data.FlushLog;
+}
+
+const char* Renderer2D::GetFlushReasonName(FlushReason reason)
+{
+	switch (reason) {
+	case FlushReason::EndScene: return "EndScene";
+	case FlushReason::BufferFull: return "BufferFull";
+	case FlushReason::SlotsFull: return "SlotsFull";
+	case FlushReason::LayerPass: return "LayerPass";
+	case FlushReason::RenderTarget: return "RenderTarget";
+	}
+	return "Unknown";
 }
 
 void Renderer2D::Init() {
@@ -170,15 +261,16 @@ void Renderer2D::Init() {
 	);
 
 	glEnableVertexAttribArray(2); // texcoord
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE,
+	glVertexAttribPointer(2, 2, GL_UNSIGNED_SHORT, GL_TRUE,
 		sizeof(QuadVertex), (const void*)offsetof(QuadVertex, TexCoords));
 
+	// Los enteros pequeños llegan al shader ya convertidos a float
 	glEnableVertexAttribArray(3); // tex index
-	glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE,
+	glVertexAttribPointer(3, 1, GL_UNSIGNED_BYTE, GL_FALSE,
 		sizeof(QuadVertex), (const void*)offsetof(QuadVertex, TexIndex));
 
 	glEnableVertexAttribArray(4);
-	glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE,
+	glVertexAttribPointer(4, 1, GL_UNSIGNED_BYTE, GL_FALSE,
 		sizeof(QuadVertex), (const void*)offsetof(QuadVertex, ShapeType));
 
 	std::vector<uint32_t> indices(Renderer2DData::MaxIndices);
@@ -209,6 +301,12 @@ void Renderer2D::Init() {
 
 	s_Data.ViewProjectionLocation =
 		glGetUniformLocation(s_Data.Shader, "u_ViewProjection");
+	s_Data.AlphaCutoffLocation =
+		glGetUniformLocation(s_Data.Shader, "u_AlphaCutoff");
+	s_Data.DebugModeLocation =
+		glGetUniformLocation(s_Data.Shader, "u_DebugMode");
+	s_Data.DebugTintLocation =
+		glGetUniformLocation(s_Data.Shader, "u_DebugTint");
 
 	int samplers[Renderer2DData::MaxTextureSlots]{};
 
@@ -221,6 +319,11 @@ void Renderer2D::Init() {
 		Renderer2DData::MaxTextureSlots,
 		samplers
 	);
+	glUniform1f(s_Data.AlphaCutoffLocation, -1.0f);
+	glUniform1i(s_Data.DebugModeLocation, 0);
+
+	for (uint32_t i = 0; i < Renderer2DData::MaxSceneQueries; i++)
+		glGenQueries(2, s_Data.SceneQueries[i]);
 
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
@@ -239,6 +342,7 @@ void Renderer2D::Init() {
 	);
 
 	Texture2D* whiteTexture = new Texture2D(whiteID, 1, 1);
+	whiteTexture->m_Alpha = TextureAlpha::Opaque;
 
 	s_Data.TextureSlots[0] = whiteTexture;
 
@@ -252,6 +356,32 @@ void Renderer2D::ShutDown()
 	glDeleteBuffers(1, &s_Data.VBO);
 	glDeleteBuffers(1, &s_Data.EBO);
 	glDeleteVertexArrays(1, &s_Data.VAO);
+
+	for (uint32_t i = 0; i < Renderer2DData::MaxSceneQueries; i++)
+		glDeleteQueries(2, s_Data.SceneQueries[i]);
+}
+
+// Suma a las stats los resultados que ya estén disponibles, sin bloquear
+static void CollectSceneQueries()
+{
+	for (uint32_t i = 0; i < Renderer2DData::MaxSceneQueries; i++) {
+		if (!s_Data.QueryPending[i])
+			continue;
+
+		int available = 0;
+		glGetQueryObjectiv(s_Data.SceneQueries[i][1], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			continue;
+
+		uint64_t samples = 0, nanoseconds = 0;
+		glGetQueryObjectui64v(s_Data.SceneQueries[i][0], GL_QUERY_RESULT, &samples);
+		glGetQueryObjectui64v(s_Data.SceneQueries[i][1], GL_QUERY_RESULT, &nanoseconds);
+
+		s_Data.Stats.SamplesPassed += samples;
+		s_Data.Stats.GpuTimeMs += nanoseconds / 1e6f;
+		s_Data.Stats.GpuScenes++;
+		s_Data.QueryPending[i] = false;
+	}
 }
 
 void Renderer2D::BeginScene(const OrthographicCamera& camera) {
@@ -266,8 +396,56 @@ void Renderer2D::BeginScene(const OrthographicCamera& camera) {
 	s_Data.IndexCount = 0;
 	s_Data.VertexBufferPtr = s_Data.VertexBufferBase;
 	s_Data.TextureSlotIndex = 1;
+
+	s_Data.VisibleRect = camera.GetVisibleRect();
+
+	CollectSceneQueries();
+
+	// Si la GPU va tan atrás que no queda ninguna libre, esta escena no se mide
+	uint32_t query = s_Data.NextQuery;
+	if (!s_Data.QueryPending[query]) {
+		glBeginQuery(GL_SAMPLES_PASSED, s_Data.SceneQueries[query][0]);
+		glBeginQuery(GL_TIME_ELAPSED, s_Data.SceneQueries[query][1]);
+		s_Data.ActiveQuery = (int)query;
+	}
 }
-void Renderer2D::EndScene()
+
+void Renderer2D::SetLayeredMode(bool enabled)
+{
+	s_Data.Layered = enabled;
+}
+
+const cass::Vector4<float>& Renderer2D::GetVisibleRect()
+{
+	return s_Data.VisibleRect;
+}
+
+// Tinte de depuración para el batch que se va a dibujar
+static void SetDebugTint()
+{
+	float r, g, b;
+
+	if (s_Data.DebugMode == Renderer2DDebugMode::Batches) {
+		// Tono con la razón áurea: batches consecutivos quedan bien separados
+		float hue = fmodf(s_Data.FlushLog.size() * 0.618034f, 1.0f) * 6.0f;
+		float x = 1.0f - fabsf(fmodf(hue, 2.0f) - 1.0f);
+		int sector = (int)hue;
+
+		r = (sector == 0 || sector == 5) ? 1.0f : (sector == 1 || sector == 4) ? x : 0.0f;
+		g = (sector == 1 || sector == 2) ? 1.0f : (sector == 0 || sector == 3) ? x : 0.0f;
+		b = (sector == 3 || sector == 4) ? 1.0f : (sector == 2 || sector == 5) ? x : 0.0f;
+	}
+	else {
+		float pressure = (float)s_Data.TextureSlotIndex / Renderer2DData::MaxTextureSlots;
+		r = pressure;
+		g = 1.0f - pressure;
+		b = 0.0f;
+	}
+
+	glProgramUniform3f(s_Data.Shader, s_Data.DebugTintLocation, r, g, b);
+}
+
+static void FlushBatch(FlushReason reason)
 {
 	if (s_Data.IndexCount == 0)
 		return;
@@ -286,61 +464,308 @@ void Renderer2D::EndScene()
 	glUseProgram(s_Data.Shader);
 	glBindVertexArray(s_Data.VAO);
 
+	bool overdraw = s_Data.DebugMode == Renderer2DDebugMode::Overdraw;
+	bool blending = true;
+
+	if (overdraw) {
+		blending = glIsEnabled(GL_BLEND);
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_ONE, GL_ONE);
+	}
+	else if (s_Data.DebugMode != Renderer2DDebugMode::None) {
+		SetDebugTint();
+	}
+
 	glDrawElements(GL_TRIANGLES, s_Data.IndexCount, GL_UNSIGNED_INT, nullptr);
 	s_Data.Stats.DrawCalls++;
 	s_Data.Stats.TextureCount += s_Data.TextureSlotIndex;
 
+	if (overdraw) {
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		if (!blending)
+			glDisable(GL_BLEND);
+	}
+
+	s_Data.FlushLog.push_back({ reason, s_Data.IndexCount / 6, s_Data.TextureSlotIndex });
+
 	s_Data.IndexCount = 0;
 	s_Data.VertexBufferPtr = s_Data.VertexBufferBase;
 	s_Data.TextureSlotIndex = 1;
 }
 
-void Renderer2D::DrawQuad(const QuadProperties& properties) {
+// Devuelve el slot de la textura en el batch actual, haciendo flush si ya no caben más
+static float ResolveTextureSlot(Texture2D* texture)
+{
+	// En el modo por capas el índice es provisional: el slot real se decide al ordenar
+	if (s_Data.Layered) {
+		if (!texture)
+			texture = s_Data.TextureSlots[0];
+
+		for (uint32_t i = 0; i < s_Data.LayerTextures.size(); i++) {
+			if (s_Data.LayerTextures[i] == texture)
+				return (float)i;
+		}
 
-	auto& data = s_Data;
+		s_Data.LayerTextures.push_back(texture);
+		return (float)(s_Data.LayerTextures.size() - 1);
+	}
 
-	if (data.IndexCount >= data.MaxIndices ||
-		data.TextureSlotIndex >= data.MaxTextureSlots)
-	{
-		EndScene();
-		data.IndexCount = 0;
-		data.VertexBufferPtr = data.VertexBufferBase;
-		data.TextureSlotIndex = 1;
+	if (!texture || texture == s_Data.TextureSlots[0])
+		return 0.0f;
+
+	for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++) {
+		if (s_Data.TextureSlots[i] == texture)
+			return (float)i;
 	}
 
-	Texture2D* texture = properties.texture
-		? properties.texture
-		: s_Data.TextureSlots[0];
+	if (s_Data.TextureSlotIndex >= s_Data.MaxTextureSlots)
+		FlushBatch(FlushReason::SlotsFull);
+
+	float textureIndex = (float)s_Data.TextureSlotIndex;
+	s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
+	s_Data.TextureSlotIndex++;
+
+	return textureIndex;
+}
+
+// Se comprueba antes de resolver la textura para que un quad descartado no ocupe slot
+static inline bool IsCulled(const cass::Vector3<float>* positions)
+{
+	float minX = std::min(std::min(positions[0].x, positions[1].x), std::min(positions[2].x, positions[3].x));
+	float maxX = std::max(std::max(positions[0].x, positions[1].x), std::max(positions[2].x, positions[3].x));
+	float minY = std::min(std::min(positions[0].y, positions[1].y), std::min(positions[2].y, positions[3].y));
+	float maxY = std::max(std::max(positions[0].y, positions[1].y), std::max(positions[2].y, positions[3].y));
+
+	const cass::Vector4<float>& rect = s_Data.VisibleRect;
+
+	if (maxX < rect.x || minX > rect.z || maxY < rect.y || minY > rect.t) {
+		s_Data.Stats.CulledQuads++;
+		return true;
+	}
+
+	return false;
+}
+
+static void WriteQuad(const cass::Vector3<float>* positions, const PackedUV& uv,
+	uint32_t argb, float textureIndex, Shape shape)
+{
+	const uint16_t texCoords[4][2] = {
+		{ uv.U0, uv.V0 }, // bottom-left
+		{ uv.U1, uv.V0 }, // bottom-right
+		{ uv.U1, uv.V1 }, // top-right
+		{ uv.U0, uv.V1 }  // top-left
+	};
+
+	QuadVertex* vertex = s_Data.VertexBufferPtr;
+
+	if (s_Data.Layered) {
+		Texture2D* texture = s_Data.LayerTextures[(uint32_t)textureIndex];
 
+		// Texto y colores con alfa siempre mezclan; lo recortado se descarta en el shader
+		bool opaque = (argb >> 24) == 0xFF &&
+			(shape == Shape::Quad || shape == Shape::Circle) &&
+			texture->GetAlpha() != TextureAlpha::Translucent;
 
-	float textureIndex = 0.0f;
+		LayeredQuad& quad = (opaque ? s_Data.OpaqueQuads : s_Data.TranslucentQuads).emplace_back();
+		quad.Texture = texture;
+		quad.Z = positions[0].z;
+		vertex = quad.Vertices;
 
-	for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++) {
-		if (s_Data.TextureSlots[i] == texture) {
-			textureIndex = (float)i;
-			break;
+		if (opaque)
+			s_Data.Stats.OpaqueQuads++;
+	}
+
+	for (int i = 0; i < 4; i++) {
+		vertex[i].Position = positions[i];
+		vertex[i].ColorARGB = argb;
+		vertex[i].TexCoords[0] = texCoords[i][0];
+		vertex[i].TexCoords[1] = texCoords[i][1];
+		vertex[i].TexIndex = (uint8_t)textureIndex;
+		vertex[i].ShapeType = (uint8_t)shape;
+	}
+
+	s_Data.Stats.QuadCount++;
+
+	if (!s_Data.Layered) {
+		s_Data.VertexBufferPtr += 4;
+		s_Data.IndexCount += 6;
+	}
+}
+
+static void WriteQuad(const cass::Vector3<float>* positions, const cass::Vector4<float>& uv,
+	uint32_t argb, float textureIndex, Shape shape)
+{
+	// Los UVs viajan en 16 bits normalizados: fuera de [0, 1] se recortarían en
+	// silencio (GL_REPEAT o UVs negativos no funcionan con este vértice)
+	assert(uv.x >= 0.0f && uv.x <= 1.0f && uv.y >= 0.0f && uv.y <= 1.0f &&
+		uv.z >= 0.0f && uv.z <= 1.0f && uv.t >= 0.0f && uv.t <= 1.0f &&
+		"Renderer2D: UVs must be in [0, 1] (see PackedUV)");
+
+	WriteQuad(positions, PackedUV::FromUV(uv), argb, textureIndex, shape);
+}
+
+static void EmitLayer(const std::vector<LayeredQuad>& quads)
+{
+	for (uint32_t index : s_Data.LayerOrder) {
+		const LayeredQuad& quad = quads[index];
+
+		if (s_Data.IndexCount >= s_Data.MaxIndices)
+			FlushBatch(FlushReason::BufferFull);
+
+		uint8_t slot = (uint8_t)ResolveTextureSlot(quad.Texture);
+
+		for (int i = 0; i < 4; i++) {
+			*s_Data.VertexBufferPtr = quad.Vertices[i];
+			s_Data.VertexBufferPtr->TexIndex = slot;
+			s_Data.VertexBufferPtr++;
 		}
+
+		s_Data.IndexCount += 6;
 	}
+}
+
+// Mayor z = más cerca (la ortográfica va de -1 a 1). A igual z se respeta el
+// orden de llamada: lo último va encima, así que en la pasada opaca va primero.
+static void DrawLayers()
+{
+	std::vector<uint32_t>& order = s_Data.LayerOrder;
+	s_Data.Layered = false;
+
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+
+	const std::vector<LayeredQuad>& opaque = s_Data.OpaqueQuads;
+	order.resize(opaque.size());
+	for (uint32_t i = 0; i < order.size(); i++)
+		order[i] = i;
+
+	std::sort(order.begin(), order.end(), [&opaque](uint32_t a, uint32_t b) {
+		return opaque[a].Z != opaque[b].Z ? opaque[a].Z > opaque[b].Z : a > b;
+	});
 
-	if (textureIndex == 0.0f && texture != s_Data.TextureSlots[0]) {
+	glDisable(GL_BLEND);
+	glDepthMask(GL_TRUE);
+	glProgramUniform1f(s_Data.Shader, s_Data.AlphaCutoffLocation, 0.5f);
+	EmitLayer(opaque);
+	FlushBatch(FlushReason::LayerPass);
 
-		if (s_Data.TextureSlotIndex >= s_Data.MaxTextureSlots)
-			EndScene();
+	const std::vector<LayeredQuad>& translucent = s_Data.TranslucentQuads;
+	order.resize(translucent.size());
+	for (uint32_t i = 0; i < order.size(); i++)
+		order[i] = i;
 
-		textureIndex = (float)s_Data.TextureSlotIndex;
-		s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-		s_Data.TextureSlotIndex++;
+	std::sort(order.begin(), order.end(), [&translucent](uint32_t a, uint32_t b) {
+		return translucent[a].Z != translucent[b].Z ? translucent[a].Z < translucent[b].Z : a < b;
+	});
+
+	// Prueba contra la profundidad de lo opaco pero no la escribe. LEQUAL: lo
+	// translúcido de la misma capa que lo opaco (texto sobre tiles) va encima.
+	glEnable(GL_BLEND);
+	glDepthFunc(GL_LEQUAL);
+	glDepthMask(GL_FALSE);
+	glProgramUniform1f(s_Data.Shader, s_Data.AlphaCutoffLocation, 0.0f);
+	EmitLayer(translucent);
+	FlushBatch(FlushReason::EndScene);
+
+	glDepthMask(GL_TRUE);
+	glDepthFunc(GL_LESS);
+	glDisable(GL_DEPTH_TEST);
+	glProgramUniform1f(s_Data.Shader, s_Data.AlphaCutoffLocation, -1.0f);
+
+	s_Data.OpaqueQuads.clear();
+	s_Data.TranslucentQuads.clear();
+	s_Data.LayerTextures.clear();
+	s_Data.Layered = true;
+}
+
+void Renderer2D::EndScene()
+{
+	if (s_Data.Layered)
+		DrawLayers();
+
+	FlushBatch(FlushReason::EndScene);
+
+	if (s_Data.ActiveQuery >= 0) {
+		glEndQuery(GL_SAMPLES_PASSED);
+		glEndQuery(GL_TIME_ELAPSED);
+		s_Data.QueryPending[s_Data.ActiveQuery] = true;
+		s_Data.NextQuery = (s_Data.ActiveQuery + 1) % Renderer2DData::MaxSceneQueries;
+		s_Data.ActiveQuery = -1;
 	}
+}
 
-	cass::Vector4<float> uv = properties.uv;
+void Renderer2D::BeginPixelPerfect(const PixelPerfectParams& params)
+{
+	s_Data.PixelParams = params;
+	s_Data.PixelTarget = RenderTargetPool::Acquire({ .Width = params.width, .Height = params.height, .Depth = params.depth });
+	s_Data.PixelTarget->Bind();
+
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void Renderer2D::EndPixelPerfect()
+{
+	Framebuffer* target = s_Data.PixelTarget;
+	if (!target)
+		return;
+
+	FlushBatch(FlushReason::RenderTarget);
+	target->Unbind();
+	s_Data.PixelTarget = nullptr;
+
+	int viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	int destination;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &destination);
+
+	const int width = (int)s_Data.PixelParams.width;
+	const int height = (int)s_Data.PixelParams.height;
+
+	// Mayor escala entera que cabe; cada píxel del arte ocupa scale x scale
+	int scale = std::max(1, std::min(viewport[2] / width, viewport[3] / height));
+	int dstWidth = width * scale;
+	int dstHeight = height * scale;
+
+	uint32_t source = target->GetRendererID();
+	int srcWidth = width, srcHeight = height;
+	GLenum filter = GL_NEAREST;
+	Framebuffer* scaled = nullptr;
+
+	// Sharp bilinear: primero entero con nearest y luego lineal hasta llenar
+	// la ventana, así el filtrado solo afecta al borde entre píxeles
+	if (s_Data.PixelParams.sharpBilinear && dstWidth < viewport[2] && dstHeight < viewport[3]) {
+		scaled = RenderTargetPool::Acquire({ .Width = (uint32_t)dstWidth, .Height = (uint32_t)dstHeight, .Filter = GL_LINEAR });
+		glBlitNamedFramebuffer(source, scaled->GetRendererID(),
+			0, 0, width, height, 0, 0, dstWidth, dstHeight, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+		float fit = std::min((float)viewport[2] / width, (float)viewport[3] / height);
+		source = scaled->GetRendererID();
+		srcWidth = dstWidth;
+		srcHeight = dstHeight;
+		dstWidth = (int)(width * fit);
+		dstHeight = (int)(height * fit);
+		filter = GL_LINEAR;
+	}
+
+	int x0 = viewport[0] + (viewport[2] - dstWidth) / 2;
+	int y0 = viewport[1] + (viewport[3] - dstHeight) / 2;
+
+	glBlitNamedFramebuffer(source, destination,
+		0, 0, srcWidth, srcHeight, x0, y0, x0 + dstWidth, y0 + dstHeight, GL_COLOR_BUFFER_BIT, filter);
+
+	s_Data.Stats.OffscreenPixels += width * height;
+	s_Data.Stats.PresentedPixels += dstWidth * dstHeight;
+
+	if (scaled)
+		RenderTargetPool::Release(scaled);
+	RenderTargetPool::Release(target);
+}
+
+void Renderer2D::DrawQuad(const QuadProperties& properties) {
+
+	if (s_Data.IndexCount >= s_Data.MaxIndices)
+		FlushBatch(FlushReason::BufferFull);
 
-	cass::Vector2<float> texCoords[4] = {
-		{ uv.x, uv.y }, // bottom-left
-		{ uv.z, uv.y }, // bottom-right
-		{ uv.z, uv.t }, // top-right
-		{ uv.x, uv.t }  // top-left
-	};
-	
 	cass::Vector2<float> o = properties.origin;
 
 	cass::Vector4<float> quadPositions[4] = {
@@ -350,29 +775,65 @@ void Renderer2D::DrawQuad(const QuadProperties& properties) {
 		{-o.x,1.0f - o.y,0,1}
 	};
 
+	cass::Vector3<float> positions[4];
+
 	for (int i = 0; i < 4; i++) {
 
 		cass::Vector4<float> worldPos =
 			properties.transform * quadPositions[i];
 
-		s_Data.VertexBufferPtr->Position = {
-			worldPos.x,
-			worldPos.y,
-			worldPos.z
-		};
-
-		s_Data.VertexBufferPtr->ColorARGB = properties.argb;
-		s_Data.VertexBufferPtr->TexCoords = texCoords[i];
-		s_Data.VertexBufferPtr->TexIndex = textureIndex;
-		s_Data.VertexBufferPtr->ShapeType = (float)properties.shape;
-		s_Data.VertexBufferPtr++;
+		positions[i] = { worldPos.x, worldPos.y, worldPos.z };
 	}
 
-	s_Data.IndexCount += 6;
-	s_Data.Stats.QuadCount++;
+	if (IsCulled(positions))
+		return;
+
+	float textureIndex = ResolveTextureSlot(properties.texture);
+
+	WriteQuad(positions, properties.uv, properties.argb, textureIndex, properties.shape);
 }
 
+// Dibuja quads de glifos ya posicionados (en px de la fuente, origen en la línea base)
+// aplicando una sola rotación/escala/traslación para todo el texto.
+static void WriteGlyphQuads(const GlyphQuad* quads, size_t count, Font* font,
+	cass::Vector2<float> position, cass::Vector2<float> scale, float angle, uint32_t argb, float z)
+{
+	const float c = cos(angle);
+	const float s = sin(angle);
+	const Shape shape = font->SDF ? Shape::SDFText : Shape::Text;
+
+	float textureIndex = -1.0f;
+
+	for (size_t q = 0; q < count; q++)
+	{
+		const GlyphQuad& quad = quads[q];
+
+		if (s_Data.IndexCount >= s_Data.MaxIndices) {
+			FlushBatch(FlushReason::BufferFull);
+			textureIndex = -1.0f;
+		}
+
+		float x0 = quad.Position.x * scale.x;
+		float y0 = quad.Position.y * scale.y;
+		float x1 = x0 + quad.Size.x * scale.x;
+		float y1 = y0 + quad.Size.y * scale.y;
 
+		cass::Vector3<float> positions[4] = {
+			{ position.x + x0 * c - y0 * s, position.y + x0 * s + y0 * c, z },
+			{ position.x + x1 * c - y0 * s, position.y + x1 * s + y0 * c, z },
+			{ position.x + x1 * c - y1 * s, position.y + x1 * s + y1 * c, z },
+			{ position.x + x0 * c - y1 * s, position.y + x0 * s + y1 * c, z }
+		};
+
+		if (IsCulled(positions))
+			continue;
+
+		if (textureIndex < 0.0f)
+			textureIndex = ResolveTextureSlot(font->atlas.get());
+
+		WriteQuad(positions, quad.UV, argb, textureIndex, shape);
+	}
+}
 
 void Renderer2D::DrawCartesianLine(const CartesianLineProperties& properties)
 {
@@ -418,49 +879,171 @@ void Renderer2D::DrawCircle(const CircleProperties& properties)
 	});
 }
 
+// Equivale a translate(position) * scale(size) * rotateZ(angle) sin construir matrices
+static void SpriteCorners(cass::Vector2<float> position, cass::Vector2<float> size, float angle,
+	cass::Vector2<float> origin, float z, cass::Vector3<float>* positions)
+{
+	const float c = angle != 0.0f ? cos(angle) : 1.0f;
+	const float s = angle != 0.0f ? sin(angle) : 0.0f;
+
+	const float x0 = -origin.x, x1 = 1.0f - origin.x;
+	const float y0 = -origin.y, y1 = 1.0f - origin.y;
+
+	positions[0] = { position.x + size.x * (c * x0 - s * y0), position.y + size.y * (s * x0 + c * y0), z };
+	positions[1] = { position.x + size.x * (c * x1 - s * y0), position.y + size.y * (s * x1 + c * y0), z };
+	positions[2] = { position.x + size.x * (c * x1 - s * y1), position.y + size.y * (s * x1 + c * y1), z };
+	positions[3] = { position.x + size.x * (c * x0 - s * y1), position.y + size.y * (s * x0 + c * y1), z };
+}
+
 void Renderer2D::DrawSprite(const SpriteProperties& properties)
 {
+	if (s_Data.IndexCount >= s_Data.MaxIndices)
+		FlushBatch(FlushReason::BufferFull);
 
 	cass::Vector2<float> scale = properties.size;
 
 	if (properties.flipX) scale.x *= -1.0f;
 	if (properties.flipY) scale.y *= -1.0f;
-	
-	DrawQuad({
-		.transform = cass::Matrix4<float>()
-			.translate(properties.position)
-			.scale(scale)
-			.rotateZ(properties.angle),
-		.texture = properties.texture,
-		.uv = properties.uv,
-		.origin = properties.origin
-		});
+
+	cass::Vector3<float> positions[4];
+	SpriteCorners(properties.position, scale, properties.angle, properties.origin, properties.layer, positions);
+
+	if (IsCulled(positions))
+		return;
+
+	float textureIndex = ResolveTextureSlot(properties.texture);
+
+	WriteQuad(positions, properties.uv, 0xFFFFFFFF, textureIndex, Shape::Quad);
 }
 
-void Renderer2D::DrawText(const TextProperties& properties)
+void Renderer2D::DrawTile(const TileProperties& properties)
 {
-	Font* font = FontManager::Get(properties.font);
+	if (s_Data.IndexCount >= s_Data.MaxIndices)
+		FlushBatch(FlushReason::BufferFull);
+
+	const cass::Vector2<float>& p = properties.position;
+	const cass::Vector2<float>& s = properties.size;
+
+	const float z = properties.layer;
+
+	cass::Vector3<float> positions[4] = {
+		{ p.x, p.y, z },
+		{ p.x + s.x, p.y, z },
+		{ p.x + s.x, p.y + s.y, z },
+		{ p.x, p.y + s.y, z }
+	};
+
+	if (IsCulled(positions))
+		return;
 
-	auto cursor = properties.position;
+	float textureIndex = ResolveTextureSlot(properties.texture);
 
-	for (char c : properties.text)
+	WriteQuad(positions, properties.uv, 0xFFFFFFFF, textureIndex, Shape::Quad);
+}
+
+void Renderer2D::DrawSprites(const SpriteBatchProperties& properties)
+{
+	const uint8_t* position = (const uint8_t*)properties.positions;
+
+	Texture2D* currentTexture = nullptr;
+	float textureIndex = -1.0f;
+
+	for (uint32_t i = 0; i < properties.count; i++, position += properties.positionStride)
 	{
-		FTGlyph& g = font->Glyphs[(uint8_t)c];
+		const SpriteDrawData& sprite = properties.sprites[i];
+
+		if (s_Data.IndexCount >= s_Data.MaxIndices) {
+			FlushBatch(FlushReason::BufferFull);
+			textureIndex = -1.0f;
+		}
 
-		float x = cursor.x + g.Bearing.x * properties.scale.x;
-		float y = cursor.y - (g.Size.y - g.Bearing.y) * properties.scale.y;
+		cass::Vector2<float> size = sprite.size;
+		if (sprite.flipX) size.x *= -1.0f;
 
-		float w = g.Size.x * properties.scale.x;
-		float h = g.Size.y * properties.scale.y;
+		cass::Vector3<float> positions[4];
+		SpriteCorners(*(const cass::Vector2<float>*)position, size, sprite.angle, sprite.origin, properties.layer, positions);
 
-		DrawQuad({
-			.transform = cass::Matrix4<float>().translate({ x,y,0 }).scale({ w,h,1 }),
-			.argb = properties.argb,
-			.texture = font->atlas.get(),
-			.uv = { g.UV0.x, g.UV1.y, g.UV1.x, g.UV0.y },
-			.shape = Shape::Text
-			});
+		if (IsCulled(positions))
+			continue;
 
-		cursor.x += g.Advance * properties.scale.x;
+		// Sprites consecutivos suelen compartir textura: evita buscar el slot cada vez
+		if (textureIndex < 0.0f || sprite.texture != currentTexture) {
+			currentTexture = sprite.texture;
+			textureIndex = ResolveTextureSlot(currentTexture);
+		}
+
+		WriteQuad(positions, sprite.uv, sprite.argb, textureIndex, Shape::Quad);
 	}
 }
+
+void Renderer2D::DrawQuads(const QuadBatchProperties& properties)
+{
+	float textureIndex = -1.0f;
+
+	for (uint32_t i = 0; i < properties.count; i++)
+	{
+		if (s_Data.IndexCount >= s_Data.MaxIndices) {
+			FlushBatch(FlushReason::BufferFull);
+			textureIndex = -1.0f;
+		}
+
+		const cass::Vector2<float>* c = properties.corners + i * 4;
+
+		const float z = properties.layer;
+
+		cass::Vector3<float> positions[4] = {
+			{ c[0].x, c[0].y, z },
+			{ c[1].x, c[1].y, z },
+			{ c[2].x, c[2].y, z },
+			{ c[3].x, c[3].y, z }
+		};
+
+		if (IsCulled(positions))
+			continue;
+
+		if (textureIndex < 0.0f)
+			textureIndex = ResolveTextureSlot(properties.texture);
+
+		WriteQuad(positions, properties.uvs[i], properties.argb, textureIndex, Shape::Quad);
+	}
+}
+
+static cass::Vector2<float> TextScale(Font* font, cass::Vector2<float> scale, float size)
+{
+	if (size > 0.0f) {
+		float sizeScale = size / font->PixelSize;
+		scale = { scale.x * sizeScale, scale.y * sizeScale };
+	}
+
+	return scale;
+}
+
+void Renderer2D::DrawText(const TextProperties& properties)
+{
+	std::vector<GlyphQuad>& quads = s_Data.TextQuads;
+	cass::Vector4<float> bounds;
+
+	Font* font = FontManager::Get(properties.font);
+
+	TextLayout::Build(font, properties.text, {}, quads, bounds);
+
+	WriteGlyphQuads(quads.data(), quads.size(), font,
+		properties.position,
+		TextScale(font, properties.scale, properties.size),
+		properties.angle,
+		properties.argb,
+		properties.layer);
+}
+
+void Renderer2D::DrawTextLayout(const TextLayoutProperties& properties)
+{
+	Font* font = FontManager::Get(properties.layout.GetFont());
+	const std::vector<GlyphQuad>& quads = properties.layout.GetQuads();
+
+	WriteGlyphQuads(quads.data(), quads.size(), font,
+		properties.position,
+		TextScale(font, properties.scale, properties.size),
+		properties.angle,
+		properties.argb,
+		properties.layer);
+}
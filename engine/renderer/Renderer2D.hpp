@@ -2,11 +2,15 @@
 #include <cass_linear.hpp>
 #include "Texture2D.hpp"
 #include <camera/OrthographicCamera.hpp>
+#include "TextLayout.hpp"
+#include <PackedUV.hpp>
+#include <vector>
 
 enum class Shape : uint8_t {
 	Quad = 0,
 	Text = 1,
-	Circle = 2
+	Circle = 2,
+	SDFText = 3
 };
 
 struct Renderer2DStats {
@@ -15,13 +19,54 @@ struct Renderer2DStats {
 	uint32_t VertexCount = 0;
 	uint32_t IndexCount = 0;
 	uint32_t TextureCount = 0;
+	uint32_t CulledQuads = 0;        // descartados por quedar fuera de la cámara, sin generar vértices
+	uint32_t OpaqueQuads = 0;        // modo por capas: los que fueron por la pasada opaca
+
+	// Medido en la GPU con queries que se leen sin esperar, así que llega con
+	// uno o dos frames de retraso. SamplesPassed / píxeles de la ventana = overdraw.
+	uint64_t SamplesPassed = 0;
+	float GpuTimeMs = 0.0f;
+	uint32_t GpuScenes = 0;          // escenas cuyos resultados se sumaron arriba (no las de este frame)
+
+	// Modo pixel-perfect: píxeles que se sombrean en el target nativo frente a
+	// los que ocupa la imagen en la ventana (el ahorro es 1 - Offscreen / Presented)
+	uint32_t OffscreenPixels = 0;
+	uint32_t PresentedPixels = 0;
+};
+
+enum class Renderer2DDebugMode : uint8_t {
+	None = 0,
+	Overdraw = 1,        // cada fragmento suma calor: negro -> rojo -> amarillo -> blanco
+	Batches = 2,         // cada flush con un tinte distinto
+	TextureSlots = 3     // tinte de verde a rojo según cuántos slots de textura usó el batch
+};
+
+enum class FlushReason : uint8_t {
+	EndScene = 0,
+	BufferFull = 1,      // se llegó a MaxQuads
+	SlotsFull = 2,       // hacía falta una textura más y no quedaban slots
+	LayerPass = 3,       // modo por capas: fin de la pasada opaca
+	RenderTarget = 4     // EndPixelPerfect antes de escalar
+};
+
+struct FlushRecord {
+	FlushReason Reason;
+	uint32_t QuadCount;
+	uint32_t TextureCount;
+};
+
+struct PixelPerfectParams {
+	uint32_t width = 0;              // resolución nativa del arte
+	uint32_t height = 0;
+	bool sharpBilinear = false;      // false = solo escalado entero (con bandas); true = llena la ventana suavizando solo los bordes
+	bool depth = false;              // necesario si se usa el modo por capas (SetLayeredMode)
 };
 
 struct QuadProperties {
     cass::Matrix4<float>transform;
     uint32_t argb = 0xFFFFFFFF;
     Texture2D* texture = nullptr;
-    cass::Vector4<float> uv = { 0, 0, 1, 1 };
+    cass::Vector4<float> uv = { 0, 0, 1, 1 };   // en [0, 1]: el vértice lo guarda como PackedUV (sin repetición ni UVs negativos)
     cass::Vector2<float> origin = { 0, 0 };
 	Shape shape = Shape::Quad;
 };
@@ -55,11 +100,49 @@ struct SpriteProperties {
 	cass::Vector2<float> size;
 	float angle = 0.0f;
 	Texture2D* texture = nullptr;
-	cass::Vector4<float> uv = { 0, 0, 1, 1 };
+	cass::Vector4<float> uv = { 0, 0, 1, 1 };   // en [0, 1], igual que QuadProperties::uv
 	cass::Vector2<float> origin = { 0, 0 };
 	bool flipX = false;
 	bool flipY = false;
+	float layer = 0.0f;              // z en [-1, 1]; mayor = delante (ver SetLayeredMode)
+};
 
+// Quad alineado a los ejes con UVs ya empaquetados (ver SpriteSheet::GetPackedUV)
+struct TileProperties {
+	cass::Vector2<float> position;   // esquina inferior izquierda
+	cass::Vector2<float> size = { 1, 1 };
+	Texture2D* texture = nullptr;
+	PackedUV uv;
+	float layer = 0.0f;
+};
+
+// Quads ya transformados: 4 esquinas por quad (bl, br, tr, tl) y una sola textura
+struct QuadBatchProperties {
+	uint32_t count = 0;
+	const cass::Vector2<float>* corners = nullptr;
+	const PackedUV* uvs = nullptr;   // uno por quad
+	Texture2D* texture = nullptr;
+	uint32_t argb = 0xFFFFFFFF;
+	float layer = 0.0f;
+};
+
+// Datos por sprite para el envío en bloque (DrawSprites)
+struct SpriteDrawData {
+	Texture2D* texture = nullptr;
+	cass::Vector4<float> uv = { 0, 0, 1, 1 };   // en [0, 1], igual que QuadProperties::uv
+	cass::Vector2<float> size = { 1, 1 };
+	cass::Vector2<float> origin = { 0.5f, 0.5f };
+	float angle = 0.0f;
+	uint32_t argb = 0xFFFFFFFF;
+	bool flipX = false;
+};
+
+struct SpriteBatchProperties {
+	uint32_t count = 0;
+	const cass::Vector2<float>* positions = nullptr;   // se lee con positionStride bytes entre elementos
+	uint32_t positionStride = sizeof(cass::Vector2<float>);
+	const SpriteDrawData* sprites = nullptr;
+	float layer = 0.0f;
 };
 
 struct TextProperties {
@@ -69,6 +152,18 @@ struct TextProperties {
 	cass::Vector2<float> scale = { 1.0f,1.0f };
 	float angle = 0.0f;
 	uint32_t argb = 0xFFFFFFFF;
+	float size = 0.0f;    // tamaño en px; 0 = tamaño con el que se cargó la fuente
+	float layer = 0.0f;   // igual que en los sprites: la UI necesita ir por delante de todo
+};
+
+struct TextLayoutProperties {
+	const TextLayout& layout;
+	cass::Vector2<float> position;
+	cass::Vector2<float> scale = { 1.0f,1.0f };
+	float angle = 0.0f;
+	uint32_t argb = 0xFFFFFFFF;
+	float size = 0.0f;
+	float layer = 0.0f;
 };
 
 class Renderer2D {
@@ -80,10 +175,37 @@ public:
 	static void BeginScene(const OrthographicCamera &camera);
 	static void EndScene();
 
+	// Rectángulo visible de la escena actual (minX, minY, maxX, maxY), para
+	// descartar grupos enteros antes de llamar a Draw*
+	static const cass::Vector4<float>& GetVisibleRect();
+
+	// Con el modo por capas la escena no se dibuja en orden de llamada: al
+	// terminar, los quads opacos (textura sin alfa o recortada, color sin alfa)
+	// van de delante a atrás con depth test y sin blending, y los translúcidos
+	// de atrás a delante con blending. La capa es la z de cada quad.
+	static void SetLayeredMode(bool enabled);
+
+	// Modos de depuración que cambian cómo se pintan los batches (se puede cambiar a mitad de frame)
+	static void SetDebugMode(Renderer2DDebugMode mode);
+	static Renderer2DDebugMode GetDebugMode();
+
+	// Un registro por draw call desde el último ResetStats
+	static const std::vector<FlushRecord>& GetFlushLog();
+	static const char* GetFlushReasonName(FlushReason reason);
+
+	// Lo que se dibuje entre Begin y End se renderiza a la resolución nativa
+	// en un target aparte y se escala a la ventana (viewport actual) al terminar
+	static void BeginPixelPerfect(const PixelPerfectParams& params);
+	static void EndPixelPerfect();
+
 	static void DrawQuad(const QuadProperties &properties);
 	static void DrawCartesianLine(const CartesianLineProperties &properties);
 	static void DrawPolarLine(const PolarLineProperties &properties);
 	static void DrawCircle(const CircleProperties &properties);
 	static void DrawSprite(const SpriteProperties& properties);
+	static void DrawSprites(const SpriteBatchProperties& properties);
+	static void DrawTile(const TileProperties& properties);
+	static void DrawQuads(const QuadBatchProperties& properties);
 	static void DrawText(const TextProperties &properties);
+	static void DrawTextLayout(const TextLayoutProperties &properties);
 };
\ No newline at end of file
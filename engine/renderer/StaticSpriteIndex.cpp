@@ -0,0 +1,425 @@
+#include "StaticSpriteIndex.hpp"
+#include <algorithm>
+#include <cmath>
+
+static inline AABB Union(const AABB& a, const AABB& b)
+{
+	return {
+		{ std::min(a.Min.x, b.Min.x), std::min(a.Min.y, b.Min.y) },
+		{ std::max(a.Max.x, b.Max.x), std::max(a.Max.y, b.Max.y) }
+	};
+}
+
+static inline float Area(const AABB& box)
+{
+	return (box.Max.x - box.Min.x) * (box.Max.y - box.Min.y);
+}
+
+static inline bool Encloses(const AABB& outer, const AABB& inner)
+{
+	return outer.Min.x <= inner.Min.x && outer.Min.y <= inner.Min.y &&
+		outer.Max.x >= inner.Max.x && outer.Max.y >= inner.Max.y;
+}
+
+StaticSpriteIndex::StaticSpriteIndex(const StaticSpriteIndexParams& params)
+	: m_LeafCapacity(std::max(params.leafCapacity, 1u)),
+	m_LeafFill(std::clamp(params.leafFill, 1u, std::max(params.leafCapacity, 1u)))
+{
+}
+
+// Mismas esquinas que Renderer2D::DrawSprites (flipX invierte el ancho)
+AABB StaticSpriteIndex::ComputeBounds(const cass::Vector2<float>& position, const SpriteDrawData& sprite)
+{
+	const float c = sprite.angle != 0.0f ? cos(sprite.angle) : 1.0f;
+	const float s = sprite.angle != 0.0f ? sin(sprite.angle) : 0.0f;
+
+	const float width = sprite.flipX ? -sprite.size.x : sprite.size.x;
+	const float height = sprite.size.y;
+
+	const float xs[2] = { -sprite.origin.x, 1.0f - sprite.origin.x };
+	const float ys[2] = { -sprite.origin.y, 1.0f - sprite.origin.y };
+
+	AABB bounds = { position, position };
+	bool first = true;
+
+	for (float x : xs) {
+		for (float y : ys) {
+			cass::Vector2<float> corner(
+				position.x + width * (c * x - s * y),
+				position.y + height * (s * x + c * y));
+
+			bounds = first ? AABB{ corner, corner } : Union(bounds, { corner, corner });
+			first = false;
+		}
+	}
+
+	return bounds;
+}
+
+void StaticSpriteIndex::Build(const cass::Vector2<float>* positions, const SpriteDrawData* sprites, uint32_t count)
+{
+	std::vector<AABB> bounds(count);
+	std::vector<uint32_t> handles(count);
+
+	for (uint32_t i = 0; i < count; i++) {
+		bounds[i] = ComputeBounds(positions[i], sprites[i]);
+		handles[i] = i;
+	}
+
+	m_HandleSlots.assign(count, InvalidHandle);
+	m_FreeHandles.clear();
+	m_Count = count;
+
+	BuildTree({ positions, sprites, bounds.data(), handles.data() }, count);
+}
+
+void StaticSpriteIndex::Rebuild()
+{
+	std::vector<cass::Vector2<float>> positions;
+	std::vector<SpriteDrawData> sprites;
+	std::vector<AABB> bounds;
+	std::vector<uint32_t> handles;
+
+	positions.reserve(m_Count);
+	sprites.reserve(m_Count);
+	bounds.reserve(m_Count);
+	handles.reserve(m_Count);
+
+	for (uint32_t slot = 0; slot < m_Slots.size(); slot++) {
+		if (m_Slots[slot].Handle == InvalidHandle)
+			continue;
+
+		positions.push_back(m_Positions[slot]);
+		sprites.push_back(m_Sprites[slot]);
+		bounds.push_back(m_Slots[slot].Bounds);
+		handles.push_back(m_Slots[slot].Handle);
+	}
+
+	BuildTree({ positions.data(), sprites.data(), bounds.data(), handles.data() }, (uint32_t)handles.size());
+}
+
+void StaticSpriteIndex::BuildTree(const BuildInput& input, uint32_t count)
+{
+	m_Nodes.clear();
+	m_LeafNodes.clear();
+	m_Slots.clear();
+	m_Positions.clear();
+	m_Sprites.clear();
+
+	// Con hojas llenas hasta leafFill hay ~2 * count / leafFill nodos
+	uint32_t leaves = (count + m_LeafFill - 1) / m_LeafFill;
+	m_Nodes.reserve(leaves * 2);
+	m_LeafNodes.reserve(leaves);
+	m_Slots.reserve((size_t)leaves * m_LeafCapacity);
+	m_Positions.reserve((size_t)leaves * m_LeafCapacity);
+	m_Sprites.reserve((size_t)leaves * m_LeafCapacity);
+
+	std::vector<BuildRef> refs(count);
+	AABB centers;
+
+	// Los centros se comparan al doble de escala (Min + Max) para no dividir
+	for (uint32_t i = 0; i < count; i++) {
+		refs[i] = { input.Bounds[i], i };
+
+		cass::Vector2<float> center = input.Bounds[i].Min + input.Bounds[i].Max;
+		centers = i == 0 ? AABB{ center, center } : Union(centers, { center, center });
+	}
+
+	if (count > 0)
+		BuildNode(refs.data(), count, InvalidHandle, centers, input);
+
+	m_OverflowStart = (uint32_t)m_Slots.size();
+}
+
+// centers acota los centros de refs (a escala 2). No se recalcula en cada nodo:
+// al cortar por la mediana cada hijo se queda con su lado de la caja del padre.
+// Las cajas de los nodos internos salen de las de sus hijos; así cada nivel
+// solo recorre refs en nth_element
+uint32_t StaticSpriteIndex::BuildNode(BuildRef* refs, uint32_t count, uint32_t parent, const AABB& centers, const BuildInput& input)
+{
+	uint32_t node = (uint32_t)m_Nodes.size();
+	m_Nodes.push_back({ refs[0].Bounds, parent });
+
+	if (count <= m_LeafFill) {
+		AABB bounds = refs[0].Bounds;
+		for (uint32_t i = 1; i < count; i++)
+			bounds = Union(bounds, refs[i].Bounds);
+
+		uint32_t first = (uint32_t)m_Slots.size();
+
+		m_Slots.resize(first + m_LeafCapacity);
+		m_Positions.resize(first + m_LeafCapacity);
+		m_Sprites.resize(first + m_LeafCapacity);
+		m_LeafNodes.push_back(node);
+
+		for (uint32_t i = 0; i < count; i++) {
+			uint32_t item = refs[i].Item;
+			WriteSlot(first + i, input.Handles[item], refs[i].Bounds, input.Positions[item], input.Sprites[item]);
+		}
+
+		m_Nodes[node] = { bounds, parent, first, count };
+		return node;
+	}
+
+	// Corte por la mediana del eje más largo, redondeado a hojas completas
+	cass::Vector2<float> extent = centers.GetSize();
+	bool splitX = extent.x >= extent.y;
+
+	uint32_t leaves = (count + m_LeafFill - 1) / m_LeafFill;
+	uint32_t mid = (leaves / 2) * m_LeafFill;
+
+	std::nth_element(refs, refs + mid, refs + count, [splitX](const BuildRef& a, const BuildRef& b) {
+		return splitX
+			? a.Bounds.Min.x + a.Bounds.Max.x < b.Bounds.Min.x + b.Bounds.Max.x
+			: a.Bounds.Min.y + a.Bounds.Max.y < b.Bounds.Min.y + b.Bounds.Max.y;
+	});
+
+	cass::Vector2<float> median = refs[mid].Bounds.Min + refs[mid].Bounds.Max;
+	AABB leftCenters = centers, rightCenters = centers;
+	if (splitX)
+		leftCenters.Max.x = rightCenters.Min.x = median.x;
+	else
+		leftCenters.Max.y = rightCenters.Min.y = median.y;
+
+	uint32_t left = BuildNode(refs, mid, node, leftCenters, input);
+	uint32_t right = BuildNode(refs + mid, count - mid, node, rightCenters, input);
+
+	m_Nodes[node] = { Union(m_Nodes[left].Bounds, m_Nodes[right].Bounds), parent, right, InternalNode };
+	return node;
+}
+
+void StaticSpriteIndex::WriteSlot(uint32_t slot, uint32_t handle, const AABB& bounds,
+	const cass::Vector2<float>& position, const SpriteDrawData& sprite)
+{
+	m_Slots[slot] = { bounds, handle };
+	m_Positions[slot] = position;
+	m_Sprites[slot] = sprite;
+	m_HandleSlots[handle] = slot;
+}
+
+uint32_t StaticSpriteIndex::Insert(const cass::Vector2<float>& position, const SpriteDrawData& sprite)
+{
+	uint32_t handle;
+
+	if (!m_FreeHandles.empty()) {
+		handle = m_FreeHandles.back();
+		m_FreeHandles.pop_back();
+	}
+	else {
+		handle = (uint32_t)m_HandleSlots.size();
+		m_HandleSlots.push_back(InvalidHandle);
+	}
+
+	m_Count++;
+	Place(handle, position, sprite);
+	return handle;
+}
+
+void StaticSpriteIndex::Update(uint32_t handle, const cass::Vector2<float>& position, const SpriteDrawData& sprite)
+{
+	uint32_t slot = m_HandleSlots[handle];
+	if (slot == InvalidHandle)
+		return;
+
+	RemoveSlot(slot);
+	Place(handle, position, sprite);
+}
+
+void StaticSpriteIndex::Remove(uint32_t handle)
+{
+	uint32_t slot = m_HandleSlots[handle];
+	if (slot == InvalidHandle)
+		return;
+
+	RemoveSlot(slot);
+	m_HandleSlots[handle] = InvalidHandle;
+	m_FreeHandles.push_back(handle);
+	m_Count--;
+}
+
+void StaticSpriteIndex::Clear()
+{
+	m_Nodes.clear();
+	m_LeafNodes.clear();
+	m_Slots.clear();
+	m_Positions.clear();
+	m_Sprites.clear();
+	m_HandleSlots.clear();
+	m_FreeHandles.clear();
+	m_OverflowStart = 0;
+	m_Count = 0;
+}
+
+void StaticSpriteIndex::Place(uint32_t handle, const cass::Vector2<float>& position, const SpriteDrawData& sprite)
+{
+	AABB bounds = ComputeBounds(position, sprite);
+
+	if (!m_Nodes.empty()) {
+		// Baja por el hijo cuya caja crece menos
+		uint32_t node = 0;
+
+		while (m_Nodes[node].Count == InternalNode) {
+			uint32_t left = node + 1;
+			uint32_t right = m_Nodes[node].Child;
+
+			float growLeft = Area(Union(m_Nodes[left].Bounds, bounds)) - Area(m_Nodes[left].Bounds);
+			float growRight = Area(Union(m_Nodes[right].Bounds, bounds)) - Area(m_Nodes[right].Bounds);
+
+			node = growLeft <= growRight ? left : right;
+		}
+
+		Node& leaf = m_Nodes[node];
+
+		if (leaf.Count < m_LeafCapacity) {
+			WriteSlot(leaf.Child + leaf.Count, handle, bounds, position, sprite);
+			leaf.Count++;
+
+			// Si un nodo ya contiene la caja, sus antecesores también
+			for (uint32_t n = node; n != InvalidHandle && !Encloses(m_Nodes[n].Bounds, bounds); n = m_Nodes[n].Parent)
+				m_Nodes[n].Bounds = Union(m_Nodes[n].Bounds, bounds);
+
+			return;
+		}
+	}
+
+	uint32_t slot = (uint32_t)m_Slots.size();
+	m_Slots.emplace_back();
+	m_Positions.emplace_back();
+	m_Sprites.emplace_back();
+	WriteSlot(slot, handle, bounds, position, sprite);
+
+	// La lista aparte se recorre entera en cada consulta y en cada Draw: con
+	// un tope fijo su coste no crece con el tamaño del mundo
+	if (GetOverflowCount() > std::clamp(m_Count / 64, 64u, MaxOverflow))
+		Rebuild();
+}
+
+// Mueve el último sprite de la hoja (o de la lista aparte) al hueco; las cajas no se encogen
+void StaticSpriteIndex::RemoveSlot(uint32_t slot)
+{
+	uint32_t last;
+
+	if (slot >= m_OverflowStart) {
+		last = (uint32_t)m_Slots.size() - 1;
+	}
+	else {
+		Node& leaf = m_Nodes[m_LeafNodes[slot / m_LeafCapacity]];
+		last = leaf.Child + leaf.Count - 1;
+		leaf.Count--;
+	}
+
+	if (slot != last) {
+		m_Slots[slot] = m_Slots[last];
+		m_Positions[slot] = m_Positions[last];
+		m_Sprites[slot] = m_Sprites[last];
+		m_HandleSlots[m_Slots[slot].Handle] = slot;
+	}
+
+	if (slot >= m_OverflowStart) {
+		m_Slots.pop_back();
+		m_Positions.pop_back();
+		m_Sprites.pop_back();
+	}
+	else {
+		m_Slots[last].Handle = InvalidHandle;
+	}
+}
+
+void StaticSpriteIndex::Query(const AABB& area, std::vector<uint32_t>& out) const
+{
+	// Árbol por medianas: la profundidad es ~log2(count / leafFill)
+	uint32_t stack[64];
+	uint32_t top = 0;
+
+	if (!m_Nodes.empty())
+		stack[top++] = 0;
+
+	while (top > 0) {
+		uint32_t index = stack[--top];
+		const Node& node = m_Nodes[index];
+
+		if (!node.Bounds.Overlaps(area))
+			continue;
+
+		if (node.Count == InternalNode) {
+			stack[top++] = node.Child;
+			stack[top++] = index + 1;
+			continue;
+		}
+
+		for (uint32_t slot = node.Child; slot < node.Child + node.Count; slot++) {
+			if (m_Slots[slot].Bounds.Overlaps(area))
+				out.push_back(m_Slots[slot].Handle);
+		}
+	}
+
+	for (uint32_t slot = m_OverflowStart; slot < m_Slots.size(); slot++) {
+		if (m_Slots[slot].Bounds.Overlaps(area))
+			out.push_back(m_Slots[slot].Handle);
+	}
+}
+
+uint32_t StaticSpriteIndex::Draw(const AABB& area) const
+{
+	uint32_t stack[64];
+	uint32_t top = 0;
+	uint32_t drawn = 0;
+
+	if (!m_Nodes.empty())
+		stack[top++] = 0;
+
+	while (top > 0) {
+		uint32_t index = stack[--top];
+		const Node& node = m_Nodes[index];
+
+		if (!node.Bounds.Overlaps(area))
+			continue;
+
+		if (node.Count == InternalNode) {
+			stack[top++] = node.Child;
+			stack[top++] = index + 1;
+			continue;
+		}
+
+		// El descarte fino por sprite lo hace Renderer2D
+		if (node.Count > 0) {
+			Renderer2D::DrawSprites({
+				.count = node.Count,
+				.positions = &m_Positions[node.Child],
+				.sprites = &m_Sprites[node.Child]
+				});
+
+			drawn += node.Count;
+		}
+	}
+
+	// La lista aparte no tiene árbol: se prueba sprite a sprite y se envían
+	// seguidos los tramos que solapan
+	const uint32_t end = (uint32_t)m_Slots.size();
+	uint32_t run = m_OverflowStart;
+
+	for (uint32_t slot = m_OverflowStart; slot <= end; slot++) {
+		if (slot < end && m_Slots[slot].Bounds.Overlaps(area))
+			continue;
+
+		if (slot > run) {
+			Renderer2D::DrawSprites({
+				.count = slot - run,
+				.positions = &m_Positions[run],
+				.sprites = &m_Sprites[run]
+				});
+
+			drawn += slot - run;
+		}
+
+		run = slot + 1;
+	}
+
+	return drawn;
+}
+
+uint32_t StaticSpriteIndex::Draw() const
+{
+	const cass::Vector4<float>& rect = Renderer2D::GetVisibleRect();
+	return Draw({ { rect.x, rect.y }, { rect.z, rect.t } });
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <AABB.hpp>
+#include "Renderer2D.hpp"
+
+struct StaticSpriteIndexParams {
+	uint32_t leafCapacity = 16;   // sprites por hoja
+	uint32_t leafFill = 12;       // cuántos se ponen al construir; el resto queda para Insert
+};
+
+// Índice espacial para decorado estático: un BVH binario empaquetado (nodos en
+// orden DFS) que se construye de golpe con Build y devuelve solo los sprites
+// que tocan un rectángulo. Los sprites de cada hoja están contiguos, así que
+// Draw los envía a Renderer2D::DrawSprites hoja a hoja sin copiarlos.
+//
+// Las ediciones no reconstruyen el árbol: Insert baja hasta la hoja que menos
+// crece y ajusta las cajas de sus padres; Remove quita el sprite de su hoja sin
+// encoger nada. Lo que no cabe en una hoja va a una lista aparte que se recorre
+// entera, y cuando esa lista crece demasiado se reconstruye todo.
+class StaticSpriteIndex {
+public:
+	static constexpr uint32_t InvalidHandle = 0xFFFFFFFF;
+
+	StaticSpriteIndex(const StaticSpriteIndexParams& params = {});
+
+	// Sustituye el contenido. El handle de sprites[i] es i.
+	void Build(const cass::Vector2<float>* positions, const SpriteDrawData* sprites, uint32_t count);
+
+	uint32_t Insert(const cass::Vector2<float>& position, const SpriteDrawData& sprite);
+	void Update(uint32_t handle, const cass::Vector2<float>& position, const SpriteDrawData& sprite);
+	void Remove(uint32_t handle);
+	void Clear();
+
+	// Reconstruye el árbol con lo que haya: vacía la lista aparte y vuelve a
+	// ajustar las cajas. Conviene tras editar mucho; Insert lo hace solo si hace falta.
+	void Rebuild();
+
+	uint32_t GetCount() const { return m_Count; }
+	uint32_t GetNodeCount() const { return (uint32_t)m_Nodes.size(); }
+	uint32_t GetOverflowCount() const { return (uint32_t)m_Slots.size() - m_OverflowStart; }
+
+	// Añade a out el handle de cada sprite cuya caja solapa con area
+	void Query(const AABB& area, std::vector<uint32_t>& out) const;
+
+	// Envía a Renderer2D las hojas que solapan con area y los sprites de la lista
+	// aparte que solapan; devuelve cuántos sprites envió
+	uint32_t Draw(const AABB& area) const;
+
+	// Igual, con el rectángulo visible de la escena actual (ver Renderer2D::GetVisibleRect)
+	uint32_t Draw() const;
+
+private:
+	static constexpr uint32_t InternalNode = 0xFFFFFFFF;
+	static constexpr uint32_t MaxOverflow = 16384;   // más en la lista aparte fuerza un Rebuild
+
+	struct Node {
+		AABB Bounds;
+		uint32_t Parent = InvalidHandle;
+		uint32_t Child = 0;            // interno: hijo derecho (el izquierdo es el siguiente nodo); hoja: primer slot
+		uint32_t Count = InternalNode; // hoja: sprites ocupados desde Child
+	};
+
+	// Datos de un sprite ocupando un slot; Positions y Sprites van aparte para DrawSprites
+	struct Slot {
+		AABB Bounds;
+		uint32_t Handle = InvalidHandle;
+	};
+
+	// La caja va copiada para que cada nivel del árbol la recorra en orden
+	struct BuildRef {
+		AABB Bounds;
+		uint32_t Item;
+	};
+
+	struct BuildInput {
+		const cass::Vector2<float>* Positions;
+		const SpriteDrawData* Sprites;
+		const AABB* Bounds;
+		const uint32_t* Handles;
+	};
+
+	static AABB ComputeBounds(const cass::Vector2<float>& position, const SpriteDrawData& sprite);
+
+	void BuildTree(const BuildInput& input, uint32_t count);
+	uint32_t BuildNode(BuildRef* refs, uint32_t count, uint32_t parent, const AABB& centers, const BuildInput& input);
+
+	void Place(uint32_t handle, const cass::Vector2<float>& position, const SpriteDrawData& sprite);
+	void RemoveSlot(uint32_t slot);
+	void WriteSlot(uint32_t slot, uint32_t handle, const AABB& bounds,
+		const cass::Vector2<float>& position, const SpriteDrawData& sprite);
+
+	uint32_t m_LeafCapacity;
+	uint32_t m_LeafFill;
+
+	std::vector<Node> m_Nodes;
+	std::vector<uint32_t> m_LeafNodes;      // nodo de cada tramo de m_LeafCapacity slots
+
+	std::vector<Slot> m_Slots;
+	std::vector<cass::Vector2<float>> m_Positions;
+	std::vector<SpriteDrawData> m_Sprites;
+	uint32_t m_OverflowStart = 0;           // slots a partir de aquí no están en ninguna hoja
+
+	std::vector<uint32_t> m_HandleSlots;    // InvalidHandle = handle libre
+	std::vector<uint32_t> m_FreeHandles;
+	uint32_t m_Count = 0;
+};
@@ -0,0 +1,182 @@
+#include "TextLayout.hpp"
+#include "FontManager.hpp"
+#include <algorithm>
+
+TextLayout::TextLayout(uint32_t font, const std::string& text, const TextLayoutParams& params)
+	: m_Font(font), m_Text(text), m_Params(params)
+{
+}
+
+void TextLayout::SetText(std::string_view text)
+{
+	if (text == m_Text)
+		return;
+
+	m_Text.assign(text);
+	m_Dirty = true;
+}
+
+void TextLayout::SetParams(const TextLayoutParams& params)
+{
+	m_Params = params;
+	m_Dirty = true;
+}
+
+const std::vector<GlyphQuad>& TextLayout::GetQuads() const
+{
+	Validate();
+	return m_Quads;
+}
+
+const cass::Vector4<float>& TextLayout::GetBounds() const
+{
+	Validate();
+	return m_Bounds;
+}
+
+void TextLayout::Validate() const
+{
+	Font* font = FontManager::Get(m_Font);
+
+	// Si el atlas desalojó glifos, los UV de los no-ASCII pueden ser otros
+	if (!m_DynamicGlyphs.empty() && m_AtlasGeneration != font->AtlasGeneration)
+		m_Dirty = true;
+
+	if (m_Dirty) {
+		Rebuild();
+		return;
+	}
+
+	// Mantiene vivos en la cache los glifos no-ASCII que este texto va a dibujar
+	for (uint32_t key : m_DynamicGlyphs)
+		FontManager::GetGlyph(font, key);
+
+	if (m_AtlasGeneration != font->AtlasGeneration)
+		Rebuild();
+}
+
+void TextLayout::Rebuild() const
+{
+	Font* font = FontManager::Get(m_Font);
+
+	m_LineCount = Build(font, m_Text, m_Params, m_Quads, m_Bounds, &m_DynamicGlyphs);
+	m_AtlasGeneration = font->AtlasGeneration;
+	m_Dirty = false;
+}
+
+uint32_t TextLayout::Build(Font* font, std::string_view text, const TextLayoutParams& params,
+	std::vector<GlyphQuad>& quads, cass::Vector4<float>& bounds,
+	std::vector<uint32_t>* dynamicGlyphs)
+{
+	quads.clear();
+	if (dynamicGlyphs)
+		dynamicGlyphs->clear();
+
+	const float lineHeight = font->LineHeight * params.lineSpacing;
+	const size_t NO_BREAK = (size_t)-1;
+
+	float penX = 0.0f;
+	float penY = 0.0f;
+	size_t lineFirst = 0;
+	uint32_t lineCount = 0;
+
+	// Cada línea se alinea en cuanto se cierra: quads [first, last) con su ancho final
+	auto closeLine = [&](size_t last, float width) {
+		float offset = 0.0f;
+		if (params.align == TextAlign::Center) offset = -width * 0.5f;
+		else if (params.align == TextAlign::Right) offset = -width;
+
+		if (offset != 0.0f) {
+			for (size_t i = lineFirst; i < last; i++)
+				quads[i].Position.x += offset;
+		}
+
+		lineCount++;
+	};
+
+	// Último espacio de la línea actual: ahí se parte si se pasa de maxWidth
+	size_t breakQuad = NO_BREAK;
+	float breakPen = 0.0f;
+	float breakWidth = 0.0f;
+
+	const ShapedRun& run = FontManager::Shape(font, text);
+
+	for (const ShapedGlyph& shaped : run.Glyphs)
+	{
+		uint32_t codepoint = shaped.Codepoint;
+
+		if (codepoint == '\n') {
+			closeLine(quads.size(), penX);
+			lineFirst = quads.size();
+			penX = 0.0f;
+			penY -= lineHeight;
+			breakQuad = NO_BREAK;
+			continue;
+		}
+
+		uint32_t key = shaped.GlyphKey();
+		const FTGlyph& g = FontManager::GetGlyph(font, key);
+
+		if (key >= 128 && dynamicGlyphs)
+			dynamicGlyphs->push_back(key);
+
+		penX += shaped.XOffset;
+
+		if (codepoint == ' ') {
+			breakWidth = penX;
+			penX += shaped.XAdvance;
+			breakQuad = quads.size();
+			breakPen = penX;
+			continue;
+		}
+
+		if (params.maxWidth > 0.0f && breakQuad != NO_BREAK &&
+			penX + g.Bearing.x + g.Size.x > params.maxWidth)
+		{
+			closeLine(breakQuad, breakWidth);
+
+			for (size_t i = breakQuad; i < quads.size(); i++) {
+				quads[i].Position.x -= breakPen;
+				quads[i].Position.y -= lineHeight;
+			}
+
+			penX -= breakPen;
+			penY -= lineHeight;
+			lineFirst = breakQuad;
+			breakQuad = NO_BREAK;
+		}
+
+		if (g.Size.x > 0.0f && g.Size.y > 0.0f) {
+			quads.push_back({
+				.Position = { penX + g.Bearing.x, penY + shaped.YOffset - (g.Size.y - g.Bearing.y) },
+				.Size = g.Size,
+				.UV = { g.UV0.x, g.UV1.y, g.UV1.x, g.UV0.y }
+				});
+		}
+
+		penX += shaped.XAdvance;
+	}
+
+	closeLine(quads.size(), penX);
+
+	// ===============================
+	// Bounds
+	// ===============================
+
+	bounds = { 0, 0, 0, 0 };
+
+	if (!quads.empty())
+	{
+		bounds = { quads[0].Position.x, quads[0].Position.y, quads[0].Position.x, quads[0].Position.y };
+
+		for (const GlyphQuad& quad : quads)
+		{
+			bounds.x = std::min(bounds.x, quad.Position.x);
+			bounds.y = std::min(bounds.y, quad.Position.y);
+			bounds.z = std::max(bounds.z, quad.Position.x + quad.Size.x);
+			bounds.t = std::max(bounds.t, quad.Position.y + quad.Size.y);
+		}
+	}
+
+	return lineCount;
+}
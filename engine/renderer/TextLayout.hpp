@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cass_linear.hpp>
+
+struct Font;
+
+enum class TextAlign : uint8_t {
+	Left = 0,
+	Center = 1,
+	Right = 2
+};
+
+struct TextLayoutParams {
+	float maxWidth = 0.0f;     // en px de la fuente; 0 = no se parten las líneas
+	TextAlign align = TextAlign::Left;
+	float lineSpacing = 1.0f;
+};
+
+struct GlyphQuad {
+	cass::Vector2<float> Position;   // esquina inferior izquierda, relativa a la línea base
+	cass::Vector2<float> Size;
+	cass::Vector4<float> UV;
+};
+
+// Texto ya maquetado: los quads de cada glifo se calculan una sola vez y
+// Renderer2D::DrawTextLayout solo les aplica la transformación.
+class TextLayout {
+public:
+	TextLayout() = default;
+	TextLayout(uint32_t font, const std::string& text, const TextLayoutParams& params = {});
+
+	// Solo se vuelve a maquetar si el texto realmente cambió
+	void SetText(std::string_view text);
+	void SetParams(const TextLayoutParams& params);
+
+	uint32_t GetFont() const { return m_Font; }
+	const std::string& GetText() const { return m_Text; }
+	const std::vector<GlyphQuad>& GetQuads() const;
+	const cass::Vector4<float>& GetBounds() const; // minX, minY, maxX, maxY
+	uint32_t GetLineCount() const { return m_LineCount; }
+
+	static uint32_t Build(Font* font, std::string_view text, const TextLayoutParams& params,
+		std::vector<GlyphQuad>& quads, cass::Vector4<float>& bounds,
+		std::vector<uint32_t>* dynamicGlyphs = nullptr);
+
+private:
+	void Rebuild() const;
+	void Validate() const;
+
+	uint32_t m_Font = 0;
+	std::string m_Text;
+	TextLayoutParams m_Params;
+
+	mutable std::vector<GlyphQuad> m_Quads;
+	mutable std::vector<uint32_t> m_DynamicGlyphs;
+	mutable cass::Vector4<float> m_Bounds;
+	mutable uint32_t m_LineCount = 0;
+	mutable uint32_t m_AtlasGeneration = 0;
+	mutable bool m_Dirty = true;
+};
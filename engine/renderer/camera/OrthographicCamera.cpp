@@ -1,5 +1,6 @@
 #include "OrthographicCamera.hpp"
 #include <cass_linear.hpp>
+#include <cmath>
 
 OrthographicCamera::OrthographicCamera(float left, float right, float bottom, float top)
     : m_Left(left), m_Right(right), m_Bottom(bottom), m_Top(top)
@@ -45,6 +46,26 @@ void OrthographicCamera::ZoomAt(float zoomFactor, const cass::Vector3<float>& fo
     RecalculateViewMatrix();
 }
 
+cass::Vector4<float> OrthographicCamera::GetVisibleRect() const
+{
+    float halfWidth = (m_Right - m_Left) * 0.5f * std::abs(m_Zoom);
+    float halfHeight = (m_Top - m_Bottom) * 0.5f * std::abs(m_Zoom);
+    float centerX = (m_Left + m_Right) * 0.5f * m_Zoom;
+    float centerY = (m_Bottom + m_Top) * 0.5f * m_Zoom;
+
+    float c = cos(m_Rotation);
+    float s = sin(m_Rotation);
+
+    // La vista es rotateZ(-rotation) * translate(-position): de vuelta a mundo se rota por rotation
+    float x = m_Position.x + c * centerX - s * centerY;
+    float y = m_Position.y + s * centerX + c * centerY;
+
+    float extentX = std::abs(c) * halfWidth + std::abs(s) * halfHeight;
+    float extentY = std::abs(s) * halfWidth + std::abs(c) * halfHeight;
+
+    return { x - extentX, y - extentY, x + extentX, y + extentY };
+}
+
 void OrthographicCamera::RecalculateProjectionMatrix() {
     float left = m_Left * m_Zoom;
     float right = m_Right * m_Zoom;
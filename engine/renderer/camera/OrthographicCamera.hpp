@@ -16,6 +16,10 @@ public:
     float GetRotation() const { return m_Rotation; }
     float GetZoom() const { return m_Zoom; }
 
+    // Rectángulo alineado a los ejes que cubre lo que ve la cámara en
+    // coordenadas de mundo (minX, minY, maxX, maxY), con zoom y rotación
+    cass::Vector4<float> GetVisibleRect() const;
+
 private:
     void RecalculateProjectionMatrix();
     void RecalculateViewMatrix();
@@ -0,0 +1,61 @@
+#include "AnimationLibrary.hpp"
+#include <algorithm>
+
+// El clip 0 es un frame vacío y estático: un Animator sin inicializar no rompe nada
+std::vector<AnimationClip> AnimationLibrary::s_Clips = { AnimationClip{ 0, 1, 0.0f, 0.0f, true } };
+std::vector<cass::Vector4<float>> AnimationLibrary::s_FrameUVs = { cass::Vector4<float>{} };
+
+uint32_t AnimationLibrary::CreateClip(const AnimationClipParams& params)
+{
+	AnimationClip clip;
+	clip.FirstFrame = (uint32_t)s_FrameUVs.size();
+	clip.FrameTime = params.frameTime;
+	clip.InvFrameTime = params.frameTime > 0 ? 1.0f / params.frameTime : 0.0f;
+	clip.Loop = params.loop;
+
+	// Los UV se calculan una vez aquí y no en cada dibujado
+	for (const cass::Vector2<int>& frame : params.frames)
+		s_FrameUVs.push_back(params.sheet ? params.sheet->GetUV(frame.y, frame.x) : cass::Vector4<float>{});
+
+	if (params.frames.empty())
+		s_FrameUVs.push_back({});
+
+	clip.FrameCount = (uint32_t)s_FrameUVs.size() - clip.FirstFrame;
+
+	s_Clips.push_back(clip);
+	return (uint32_t)s_Clips.size() - 1;
+}
+
+static inline void Step(Animator& animator, const AnimationClip& clip, float deltaTime)
+{
+	animator.Timer += deltaTime;
+
+	uint32_t steps = (uint32_t)(animator.Timer * clip.InvFrameTime);
+	animator.Timer -= steps * clip.FrameTime;
+
+	uint32_t frame = animator.Frame + steps;
+	animator.Frame = clip.Loop ? frame % clip.FrameCount : std::min(frame, clip.FrameCount - 1);
+}
+
+void AnimationLibrary::Advance(Animator* animators, uint32_t count, float deltaTime)
+{
+	const AnimationClip* clips = s_Clips.data();
+
+	for (uint32_t i = 0; i < count; i++)
+		Step(animators[i], clips[animators[i].Clip], deltaTime);
+}
+
+void AnimationLibrary::Advance(Animator* animators, uint32_t count, float deltaTime,
+	cass::Vector4<float>* uvs, size_t uvStride)
+{
+	const AnimationClip* clips = s_Clips.data();
+	const cass::Vector4<float>* frames = s_FrameUVs.data();
+	uint8_t* out = (uint8_t*)uvs;
+
+	for (uint32_t i = 0; i < count; i++) {
+		const AnimationClip& clip = clips[animators[i].Clip];
+		Step(animators[i], clip, deltaTime);
+
+		*(cass::Vector4<float>*)(out + i * uvStride) = frames[clip.FirstFrame + animators[i].Frame];
+	}
+}
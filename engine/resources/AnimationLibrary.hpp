@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <cass_linear.hpp>
+#include <SpriteSheet.hpp>
+
+struct AnimationClipParams {
+	const SpriteSheet* sheet = nullptr;
+	std::vector<cass::Vector2<int>> frames;   // (col, row) de cada frame
+	float frameTime = 0;
+	bool loop = true;
+};
+
+// Datos compartidos e inmutables de una animación: sus frames son un tramo
+// de la tabla global de UVs
+struct AnimationClip {
+	uint32_t FirstFrame = 0;
+	uint32_t FrameCount = 0;
+	float FrameTime = 0;
+	float InvFrameTime = 0;
+	bool Loop = true;
+};
+
+// Estado por entidad: lo único que se copia y se actualiza cada frame
+struct Animator {
+	uint32_t Clip = 0;
+	uint32_t Frame = 0;
+	float Timer = 0;
+};
+
+class AnimationLibrary
+{
+public:
+	static uint32_t CreateClip(const AnimationClipParams& params);
+	static const AnimationClip& GetClip(uint32_t clip) { return s_Clips[clip]; }
+
+	// Cambia de clip empezando desde el primer frame; no hace nada si ya es el actual
+	static void Play(Animator& animator, uint32_t clip) {
+		if (animator.Clip != clip)
+			animator = { clip, 0, 0.0f };
+	}
+
+	static bool IsFinished(const Animator& animator) {
+		const AnimationClip& clip = s_Clips[animator.Clip];
+		return !clip.Loop && animator.Frame + 1 >= clip.FrameCount;
+	}
+
+	static const cass::Vector4<float>& GetUV(const Animator& animator) {
+		return s_FrameUVs[s_Clips[animator.Clip].FirstFrame + animator.Frame];
+	}
+
+	// Avanza todos los animators en una sola pasada. Puede saltar varios frames
+	// si dt es grande. Seguro desde varios hilos mientras nadie cree clips.
+	static void Advance(Animator* animators, uint32_t count, float deltaTime);
+
+	// Igual que Advance y además escribe el UV del frame actual en uvs[i]
+	// (uvStride en bytes, para escribir directamente dentro de otro struct)
+	static void Advance(Animator* animators, uint32_t count, float deltaTime,
+		cass::Vector4<float>* uvs, size_t uvStride);
+
+private:
+	static std::vector<AnimationClip> s_Clips;
+	static std::vector<cass::Vector4<float>> s_FrameUVs;
+};
@@ -1,8 +1,92 @@
 #include "FontManager.hpp"
+#include FT_MODULE_H
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <Utf8.hpp>
 
 
 FT_Library FontManager::s_FreeType;
 std::vector<Font> FontManager::s_Fonts;
+std::string FontManager::s_CacheDirectory = "cache";
+uint64_t FontManager::s_Frame = 1;
+std::unique_ptr<TextShaper> FontManager::s_Shaper = std::make_unique<KerningShaper>();
+
+// Al pasar de este número de cadenas distintas la cache de shaping se vacía
+static const size_t MAX_SHAPE_CACHE_ENTRIES = 4096;
+
+// Igual para los pares de kerning fuera de ASCII
+static const size_t MAX_DYNAMIC_KERNING_PAIRS = 8192;
+
+// ===============================
+// Cache format
+// ===============================
+
+static const uint32_t FONT_CACHE_MAGIC = 0x544E4643; // "CFNT"
+static const uint32_t FONT_CACHE_VERSION = 3;
+
+struct FontCacheHeader {
+	uint32_t Magic = FONT_CACHE_MAGIC;
+	uint32_t Version = FONT_CACHE_VERSION;
+	uint64_t FontHash = 0;
+	uint32_t PixelSize = 0;
+	uint32_t Mode = 0;
+	uint32_t SDFSpread = 0;
+	uint32_t AtlasWidth = 0;
+	uint32_t AtlasHeight = 0;
+	uint32_t UsedRows = 0;    // solo se guardan las filas ocupadas del atlas
+	uint32_t GlyphCount = 0;
+	uint32_t HasKerning = 0;
+	uint32_t KerningPairCount = 0;
+	float LineHeight = 0;
+};
+
+struct FontCacheKerningPair {
+	uint64_t Key;
+	float Value;
+};
+
+static uint64_t KerningKey(uint32_t left, uint32_t right)
+{
+	return ((uint64_t)left << 32) | right;
+}
+
+// Bytes de mapa de bits de los glifos ASCII (lo que ocupan de verdad en el atlas)
+static size_t AsciiGlyphBytes(const Font& font)
+{
+	size_t bytes = 0;
+	for (const FTGlyph& glyph : font.Glyphs)
+		bytes += (size_t)glyph.Size.x * (size_t)glyph.Size.y;
+	return bytes;
+}
+
+// FNV-1a de 64 bits sobre el contenido del archivo de fuente
+static uint64_t HashFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open())
+		return 0;
+
+	uint64_t hash = 0xcbf29ce484222325ull;
+	char buffer[64 * 1024];
+
+	while (file)
+	{
+		file.read(buffer, sizeof(buffer));
+		std::streamsize count = file.gcount();
+
+		for (std::streamsize i = 0; i < count; i++)
+		{
+			hash ^= (uint8_t)buffer[i];
+			hash *= 0x100000001b3ull;
+		}
+	}
+
+	return hash;
+}
 
 void FontManager::Init()
 {
@@ -12,6 +96,12 @@ void FontManager::Init()
 
 void FontManager::Shutdown()
 {
+	for (Font& font : s_Fonts)
+	{
+		if (font.Face)
+			FT_Done_Face(font.Face);
+	}
+
 	s_Fonts.clear();
 
 	if (s_FreeType)
@@ -21,9 +111,59 @@ void FontManager::Shutdown()
 	}
 }
 
+void FontManager::SetCacheDirectory(const std::string& directory)
+{
+	s_CacheDirectory = directory;
+}
+
 
-uint32_t FontManager::Load(const std::string& path, uint32_t size)
+uint32_t FontManager::Load(const std::string& path, uint32_t size, const FontParams& params)
 {
+	auto start = std::chrono::high_resolution_clock::now();
+
+	auto elapsedMs = [&start]() {
+		return std::chrono::duration<float, std::milli>(
+			std::chrono::high_resolution_clock::now() - start).count();
+	};
+
+	const bool sdf = params.Mode == FontRenderMode::SDF;
+
+	Font font;
+	font.PixelSize = (float)size;
+	font.SDF = sdf;
+	font.Path = path;
+	font.Params = params;
+
+	// ===============================
+	// Try cache first (no FreeType)
+	// ===============================
+
+	uint64_t fontHash = 0;
+	std::string cachePath;
+
+	if (!s_CacheDirectory.empty())
+	{
+		fontHash = HashFile(path);
+
+		cachePath = (std::filesystem::path(s_CacheDirectory) /
+			std::format("{}_{}{}_{:016x}.fontcache",
+				std::filesystem::path(path).stem().string(), size,
+				sdf ? std::format("_sdf{}", params.SDFSpread) : "", fontHash)).string();
+
+		if (fontHash && LoadFromCache(cachePath, fontHash, size, params, font))
+		{
+			s_Fonts.push_back(std::move(font));
+			uint32_t handle = (uint32_t)(s_Fonts.size() - 1);
+
+			std::cout << "[FontManager] Font loaded from cache: "
+				<< path << " (" << size << "px" << (sdf ? " SDF" : "") << ") -> ID: "
+				<< handle << " in " << elapsedMs() << " ms, glyphs "
+				<< AsciiGlyphBytes(s_Fonts[handle]) / 1024.0f << " KB\n";
+
+			return handle;
+		}
+	}
+
 	if (!s_FreeType)
 	{
 		std::cout << "[FontManager] ERROR: FreeType not initialized!\n";
@@ -39,7 +179,11 @@ uint32_t FontManager::Load(const std::string& path, uint32_t size)
 
 	FT_Set_Pixel_Sizes(face, 0, size);
 
-	Font font;
+	if (font.SDF)
+	{
+		FT_Int spread = (FT_Int)params.SDFSpread;
+		FT_Property_Set(s_FreeType, "sdf", "spread", &spread);
+	}
 
 	// 👉 aquí reutilizas TU código de atlas casi igual
 	const uint32_t ATLAS_WIDTH = 1024;
@@ -63,13 +207,25 @@ uint32_t FontManager::Load(const std::string& path, uint32_t size)
 
 	for (unsigned char c = 0; c < 128; c++)
 	{
-		if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
+		if (FT_Load_Char(face, c, font.SDF ? FT_LOAD_DEFAULT : FT_LOAD_RENDER)) {
 			std::cout << "[Renderer2D] Warning: Failed glyph '" << c << "'\n";
 			continue;
 		}
 
 		FT_GlyphSlot g = face->glyph;
 
+		// Los glifos sin contorno (espacio) no generan SDF, solo avance
+		if (font.SDF && FT_Render_Glyph(g, FT_RENDER_MODE_SDF)) {
+			font.Glyphs[c] = FTGlyph{
+				.Size = { 0, 0 },
+				.Bearing = { 0, 0 },
+				.Advance = (float)(g->advance.x >> 6),
+				.UV0 = { 0, 0 },
+				.UV1 = { 0, 0 }
+			};
+			continue;
+		}
+
 		// New row if needed
 		if (x + g->bitmap.width + PADDING >= ATLAS_WIDTH) {
 			x = 0;
@@ -114,6 +270,10 @@ uint32_t FontManager::Load(const std::string& path, uint32_t size)
 		rowHeight = std::max(rowHeight, g->bitmap.rows);
 	}
 
+	uint32_t usedRows = std::min(y + rowHeight + PADDING, ATLAS_HEIGHT);
+
+	LoadAsciiKerning(font, face);
+
 	// ===============================
 	// Create atlas texture
 	// ===============================
@@ -126,13 +286,20 @@ uint32_t FontManager::Load(const std::string& path, uint32_t size)
 
 	FT_Done_Face(face);
 
+	if (!cachePath.empty() && fontHash)
+		WriteCache(cachePath, fontHash, size, params, font, atlasBuffer, usedRows);
+
+	SetupGlyphCache(font, usedRows);
+
 	s_Fonts.push_back(std::move(font));
 
 	uint32_t handle = (uint32_t)(s_Fonts.size() - 1);
 
 	std::cout << "[FontManager] Font loaded successfully: "
-		<< path << " (" << size << "px) -> ID: "
-		<< handle << "\n";
+		<< path << " (" << size << "px" << (sdf ? " SDF" : "") << ") -> ID: "
+		<< handle << " in " << elapsedMs() << " ms, glyphs "
+		<< AsciiGlyphBytes(s_Fonts[handle]) / 1024.0f << " KB in "
+		<< usedRows << "/" << ATLAS_HEIGHT << " atlas rows\n";
 
 	return handle;
 }
@@ -140,4 +307,440 @@ uint32_t FontManager::Load(const std::string& path, uint32_t size)
 Font* FontManager::Get(uint32_t handle)
 {
 	return &s_Fonts[handle];
-}
\ No newline at end of file
+}
+
+bool FontManager::LoadFromCache(const std::string& cachePath, uint64_t fontHash, uint32_t size,
+	const FontParams& params, Font& font)
+{
+	std::ifstream file(cachePath, std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	FontCacheHeader header;
+	file.read((char*)&header, sizeof(header));
+
+	if (!file ||
+		header.Magic != FONT_CACHE_MAGIC ||
+		header.Version != FONT_CACHE_VERSION ||
+		header.FontHash != fontHash ||
+		header.PixelSize != size ||
+		header.Mode != (uint32_t)params.Mode ||
+		(params.Mode == FontRenderMode::SDF && header.SDFSpread != params.SDFSpread) ||
+		header.GlyphCount != 128 ||
+		header.UsedRows > header.AtlasHeight)
+	{
+		std::cout << "[FontManager] Warning: stale font cache ignored: " << cachePath << "\n";
+		return false;
+	}
+
+	file.read((char*)font.Glyphs, sizeof(FTGlyph) * header.GlyphCount);
+
+	std::vector<unsigned char> atlasBuffer(
+		(size_t)header.AtlasWidth * header.AtlasHeight,
+		0
+	);
+
+	file.read((char*)atlasBuffer.data(), (std::streamsize)header.AtlasWidth * header.UsedRows);
+
+	font.HasKerning = header.HasKerning != 0;
+
+	for (uint32_t i = 0; i < header.KerningPairCount && file; i++)
+	{
+		FontCacheKerningPair pair;
+		file.read((char*)&pair, sizeof(pair));
+		font.Kerning[pair.Key] = pair.Value;
+	}
+
+	if (!file)
+	{
+		std::cout << "[FontManager] Warning: truncated font cache ignored: " << cachePath << "\n";
+		return false;
+	}
+
+	font.LineHeight = header.LineHeight;
+	font.atlas = std::make_unique<Texture2D>(
+		header.AtlasWidth,
+		header.AtlasHeight,
+		atlasBuffer.data()
+	);
+
+	SetupGlyphCache(font, header.UsedRows);
+
+	return true;
+}
+
+void FontManager::WriteCache(const std::string& cachePath, uint64_t fontHash, uint32_t size,
+	const FontParams& params, const Font& font, const std::vector<unsigned char>& atlasBuffer, uint32_t usedRows)
+{
+	std::error_code ec;
+	std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), ec);
+
+	std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		std::cout << "[FontManager] Warning: could not write font cache: " << cachePath << "\n";
+		return;
+	}
+
+	FontCacheHeader header;
+	header.FontHash = fontHash;
+	header.PixelSize = size;
+	header.Mode = (uint32_t)params.Mode;
+	header.SDFSpread = params.SDFSpread;
+	header.AtlasWidth = font.atlas->GetWidth();
+	header.AtlasHeight = font.atlas->GetHeight();
+	header.UsedRows = usedRows;
+	header.GlyphCount = 128;
+	header.HasKerning = font.HasKerning ? 1 : 0;
+	header.KerningPairCount = (uint32_t)font.Kerning.size();
+	header.LineHeight = font.LineHeight;
+
+	file.write((const char*)&header, sizeof(header));
+	file.write((const char*)font.Glyphs, sizeof(FTGlyph) * header.GlyphCount);
+	file.write((const char*)atlasBuffer.data(), (std::streamsize)header.AtlasWidth * usedRows);
+
+	for (const auto& [key, value] : font.Kerning)
+	{
+		FontCacheKerningPair pair{ key, value };
+		file.write((const char*)&pair, sizeof(pair));
+	}
+}
+
+// ===============================
+// Dynamic glyph cache
+// ===============================
+
+void FontManager::NewFrame()
+{
+	s_Frame++;
+}
+
+void FontManager::SetupGlyphCache(Font& font, uint32_t usedRows)
+{
+	const uint32_t PADDING = 1;
+
+	// Celda cuadrada con margen para ascendentes/descendentes (y el spread del SDF)
+	font.CellSize = (uint32_t)(font.PixelSize * 1.25f) + PADDING +
+		(font.SDF ? font.Params.SDFSpread * 2 : 0);
+
+	font.CellOriginY = usedRows;
+	font.CellColumns = font.atlas->GetWidth() / font.CellSize;
+
+	uint32_t cellRows = font.atlas->GetHeight() > usedRows
+		? (font.atlas->GetHeight() - usedRows) / font.CellSize
+		: 0;
+
+	font.CellCapacity = font.CellColumns * cellRows;
+	font.CacheStats.Capacity = font.CellCapacity;
+}
+
+void FontManager::UnlinkCell(Font& font, int32_t cell)
+{
+	GlyphCacheEntry& entry = font.Cells[cell];
+
+	if (entry.Prev >= 0) font.Cells[entry.Prev].Next = entry.Next;
+	else font.LruHead = entry.Next;
+
+	if (entry.Next >= 0) font.Cells[entry.Next].Prev = entry.Prev;
+	else font.LruTail = entry.Prev;
+
+	entry.Prev = entry.Next = -1;
+}
+
+void FontManager::TouchCell(Font& font, int32_t cell)
+{
+	GlyphCacheEntry& entry = font.Cells[cell];
+	entry.LastFrame = s_Frame;
+
+	if (font.LruHead == cell)
+		return;
+
+	if (entry.Prev >= 0 || entry.Next >= 0 || font.LruTail == cell)
+		UnlinkCell(font, cell);
+
+	entry.Next = font.LruHead;
+	if (font.LruHead >= 0) font.Cells[font.LruHead].Prev = cell;
+	font.LruHead = cell;
+	if (font.LruTail < 0) font.LruTail = cell;
+}
+
+bool FontManager::RasterizeIntoCell(Font& font, uint32_t key, int32_t cell)
+{
+	if (!EnsureFace(font))
+		return false;
+
+	if (font.SDF)
+	{
+		FT_Int spread = (FT_Int)font.Params.SDFSpread;
+		FT_Property_Set(s_FreeType, "sdf", "spread", &spread);
+	}
+
+	const FT_Int32 loadFlags = font.SDF ? FT_LOAD_DEFAULT : FT_LOAD_RENDER;
+
+	FT_Error error = (key & ShapedGlyph::IndexKeyFlag)
+		? FT_Load_Glyph(font.Face, key & ~ShapedGlyph::IndexKeyFlag, loadFlags)
+		: FT_Load_Char(font.Face, key, loadFlags);
+
+	if (error)
+		return false;
+
+	FT_GlyphSlot g = font.Face->glyph;
+
+	FTGlyph glyph{};
+	glyph.Advance = (float)(g->advance.x >> 6);
+
+	const uint32_t cellX = (cell % font.CellColumns) * font.CellSize;
+	const uint32_t cellY = font.CellOriginY + (cell / font.CellColumns) * font.CellSize;
+
+	bool hasBitmap = !font.SDF || !FT_Render_Glyph(g, FT_RENDER_MODE_SDF);
+
+	// Se sube la celda completa para limpiar lo que dejó el glifo desalojado
+	std::vector<unsigned char>& scratch = font.CellPixels;
+	scratch.assign((size_t)font.CellSize * font.CellSize, 0);
+
+	uint32_t w = 0, h = 0;
+
+	if (hasBitmap)
+	{
+		w = std::min<uint32_t>(g->bitmap.width, font.CellSize - 1);
+		h = std::min<uint32_t>(g->bitmap.rows, font.CellSize - 1);
+
+		for (uint32_t row = 0; row < h; row++)
+		{
+			memcpy(
+				&scratch[row * font.CellSize],
+				&g->bitmap.buffer[row * g->bitmap.pitch],
+				w
+			);
+		}
+
+		glyph.Size = { (float)w, (float)h };
+		glyph.Bearing = { (float)g->bitmap_left, (float)g->bitmap_top };
+	}
+
+	const float atlasW = (float)font.atlas->GetWidth();
+	const float atlasH = (float)font.atlas->GetHeight();
+
+	glyph.UV0 = { cellX / atlasW, cellY / atlasH };
+	glyph.UV1 = { (cellX + w) / atlasW, (cellY + h) / atlasH };
+
+	font.atlas->SetData(cellX, cellY, font.CellSize, font.CellSize, scratch.data());
+
+	GlyphCacheEntry& entry = font.Cells[cell];
+	entry.Key = key;
+	entry.Glyph = glyph;
+
+	font.CacheStats.Rasterized++;
+	return true;
+}
+
+const FTGlyph& FontManager::GetGlyph(Font* font, uint32_t key)
+{
+	if (key < 128)
+		return font->Glyphs[key];
+
+	auto it = font->CellLookup.find(key);
+	if (it != font->CellLookup.end())
+	{
+		TouchCell(*font, it->second);
+		return font->Cells[it->second].Glyph;
+	}
+
+	if (font->CellCapacity == 0)
+		return font->Glyphs['?'];
+
+	if (font->Cells.empty())
+		font->Cells.resize(font->CellCapacity);
+
+	int32_t cell;
+
+	if (font->UsedCells < font->CellCapacity)
+	{
+		cell = (int32_t)font->UsedCells++;
+	}
+	else
+	{
+		// Atlas lleno: se desaloja el menos usado, salvo que ya se haya dibujado en este frame
+		cell = font->LruTail;
+
+		if (font->Cells[cell].LastFrame == s_Frame)
+			return font->Glyphs['?'];
+
+		font->CellLookup.erase(font->Cells[cell].Key);
+		UnlinkCell(*font, cell);
+		font->CacheStats.Evictions++;
+		font->AtlasGeneration++;
+	}
+
+	if (!RasterizeIntoCell(*font, key, cell))
+	{
+		// El glifo de reemplazo ocupa la celda para no reintentar cada frame
+		font->Cells[cell].Key = key;
+		font->Cells[cell].Glyph = font->Glyphs['?'];
+	}
+
+	font->CellLookup[key] = cell;
+	TouchCell(*font, cell);
+
+	font->CacheStats.Resident = (uint32_t)font->CellLookup.size();
+	return font->Cells[cell].Glyph;
+}
+
+bool FontManager::EnsureFace(Font& font)
+{
+	if (font.Face)
+		return true;
+
+	if (!s_FreeType)
+		return false;
+
+	// La cara solo se abre la primera vez que falta algo (los atlas cacheados no la necesitan)
+	if (FT_New_Face(s_FreeType, font.Path.c_str(), 0, &font.Face))
+	{
+		std::cout << "[FontManager] ERROR: could not reopen font: " << font.Path << "\n";
+		font.Face = nullptr;
+		return false;
+	}
+
+	FT_Set_Pixel_Sizes(font.Face, 0, (FT_UInt)font.PixelSize);
+	return true;
+}
+
+// ===============================
+// Kerning & shaping
+// ===============================
+
+void FontManager::LoadAsciiKerning(Font& font, FT_Face face)
+{
+	font.HasKerning = FT_HAS_KERNING(face);
+
+	if (!font.HasKerning)
+		return;
+
+	FT_UInt indices[128];
+	for (uint32_t c = 0; c < 128; c++)
+		indices[c] = FT_Get_Char_Index(face, c);
+
+	// Solo se guardan los pares distintos de cero (los imprimibles)
+	for (uint32_t left = 32; left < 127; left++)
+	{
+		for (uint32_t right = 32; right < 127; right++)
+		{
+			FT_Vector delta;
+			if (FT_Get_Kerning(face, indices[left], indices[right], FT_KERNING_DEFAULT, &delta))
+				continue;
+
+			if (delta.x != 0)
+				font.Kerning[KerningKey(left, right)] = (float)(delta.x >> 6);
+		}
+	}
+}
+
+float FontManager::GetKerning(Font* font, uint32_t left, uint32_t right)
+{
+	if (!font->HasKerning)
+		return 0.0f;
+
+	uint64_t key = KerningKey(left, right);
+
+	// Los pares ASCII que no están en la tabla valen cero
+	if (left < 128 && right < 128) {
+		auto it = font->Kerning.find(key);
+		return it != font->Kerning.end() ? it->second : 0.0f;
+	}
+
+	auto it = font->DynamicKerning.find(key);
+	if (it != font->DynamicKerning.end())
+		return it->second;
+
+	float value = 0.0f;
+
+	if (EnsureFace(*font))
+	{
+		FT_Vector delta;
+		if (!FT_Get_Kerning(font->Face,
+			FT_Get_Char_Index(font->Face, left),
+			FT_Get_Char_Index(font->Face, right),
+			FT_KERNING_DEFAULT, &delta))
+		{
+			value = (float)(delta.x >> 6);
+		}
+	}
+
+	if (font->DynamicKerning.size() >= MAX_DYNAMIC_KERNING_PAIRS)
+		font->DynamicKerning.clear();
+
+	font->DynamicKerning[key] = value;
+	return value;
+}
+
+void FontManager::SetShaper(std::unique_ptr<TextShaper> shaper)
+{
+	s_Shaper = shaper ? std::move(shaper) : std::make_unique<KerningShaper>();
+
+	// Lo memorizado con el shaper anterior ya no vale
+	for (Font& font : s_Fonts)
+		font.ShapeCache.clear();
+}
+
+const ShapedRun& FontManager::Shape(Font* font, std::string_view text)
+{
+	auto it = font->ShapeCache.find(text);
+	if (it != font->ShapeCache.end())
+		return it->second;
+
+	ShapedRun& scratch = font->UncachedRun;
+	scratch.Fallback = false;
+	s_Shaper->Shape(font, text, scratch);
+
+	// Con glifos de reemplazo temporales se vuelve a hacer shaping la próxima vez
+	if (scratch.Fallback)
+		return scratch;
+
+	if (font->ShapeCache.size() >= MAX_SHAPE_CACHE_ENTRIES)
+		font->ShapeCache.clear();
+
+	ShapedRun& run = font->ShapeCache[std::string(text)];
+	run = std::move(scratch);
+	return run;
+}
+
+void KerningShaper::Shape(Font* font, std::string_view text, ShapedRun& run)
+{
+	run.Glyphs.clear();
+	run.Glyphs.reserve(text.size());
+
+	const char* it = text.data();
+	const char* end = it + text.size();
+
+	uint32_t previous = 0;
+
+	while (it < end)
+	{
+		uint32_t cluster = (uint32_t)(it - text.data());
+		uint32_t codepoint = DecodeUtf8(it, end);
+
+		if (codepoint == '\n') {
+			run.Glyphs.push_back({ .Codepoint = codepoint, .GlyphIndex = 0, .Cluster = cluster,
+				.XOffset = 0.0f, .YOffset = 0.0f, .XAdvance = 0.0f });
+			previous = 0;
+			continue;
+		}
+
+		float kerning = previous ? FontManager::GetKerning(font, previous, codepoint) : 0.0f;
+
+		const FTGlyph& glyph = FontManager::GetGlyph(font, codepoint);
+		run.Fallback |= FontManager::IsFallback(font, codepoint, glyph);
+
+		run.Glyphs.push_back({
+			.Codepoint = codepoint,
+			.GlyphIndex = 0,
+			.Cluster = cluster,
+			.XOffset = kerning,
+			.YOffset = 0.0f,
+			.XAdvance = glyph.Advance
+			});
+
+		previous = codepoint;
+	}
+}
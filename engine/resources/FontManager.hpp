@@ -1,9 +1,13 @@
 #pragma once
 #include <unordered_map>
+#include <memory>
+#include <vector>
+#include <string>
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include <cass_linear.hpp>
 #include "Texture2D.hpp"
+#include "TextShaper.hpp"
 
 struct FTGlyph {
 	cass::Vector2<float> Size;
@@ -14,11 +18,72 @@ struct FTGlyph {
 	cass::Vector2<float> UV1;
 };
 
+enum class FontRenderMode : uint8_t {
+	Bitmap = 0,
+	SDF = 1    // un solo atlas sirve para cualquier tamaño
+};
+
+struct FontParams {
+	FontRenderMode Mode = FontRenderMode::Bitmap;
+	uint32_t SDFSpread = 8;    // distancia máxima (en px) codificada alrededor del contorno
+};
+
+// Celda del atlas para glifos fuera de ASCII, enlazada en una lista LRU
+struct GlyphCacheEntry {
+	uint32_t Key = 0;   // codepoint, o ShapedGlyph::IndexKey(índice)
+	FTGlyph Glyph{};
+	uint64_t LastFrame = 0;
+	int32_t Prev = -1;
+	int32_t Next = -1;
+};
+
+struct GlyphCacheStats {
+	uint32_t Resident = 0;
+	uint32_t Capacity = 0;
+	uint32_t Rasterized = 0;
+	uint32_t Evictions = 0;
+};
+
+// Búsqueda por string_view sin construir un std::string temporal
+struct ShapeCacheHash {
+	using is_transparent = void;
+	size_t operator()(std::string_view text) const { return std::hash<std::string_view>{}(text); }
+};
+
 struct Font
 {
 	std::unique_ptr<Texture2D> atlas;
 	FTGlyph Glyphs[128];
 	float LineHeight;
+	float PixelSize = 0;
+	bool SDF = false;
+
+	// ASCII vive empaquetado arriba del atlas; el resto se rasteriza bajo demanda
+	// en celdas de tamaño fijo debajo de él.
+	std::string Path;
+	FontParams Params;
+	FT_Face Face = nullptr;
+	uint32_t CellSize = 0;
+	uint32_t CellOriginY = 0;
+	uint32_t CellColumns = 0;
+	uint32_t CellCapacity = 0;
+	uint32_t UsedCells = 0;
+	std::vector<GlyphCacheEntry> Cells;
+	std::unordered_map<uint32_t, int32_t> CellLookup;
+	std::vector<unsigned char> CellPixels;   // CellSize x CellSize que se suben al rasterizar un glifo
+	int32_t LruHead = -1;
+	int32_t LruTail = -1;
+	uint32_t AtlasGeneration = 0;   // cambia cada vez que se reutiliza una celda
+	GlyphCacheStats CacheStats;
+
+	// Kerning en px: los pares ASCII se precalculan al cargar; el resto se pide
+	// bajo demanda y se guarda aparte, vaciándose al superar un límite
+	bool HasKerning = false;
+	std::unordered_map<uint64_t, float> Kerning;
+	std::unordered_map<uint64_t, float> DynamicKerning;
+
+	std::unordered_map<std::string, ShapedRun, ShapeCacheHash, std::equal_to<>> ShapeCache;
+	ShapedRun UncachedRun;   // último resultado con Fallback, que no entra en ShapeCache
 };
 
 class FontManager
@@ -27,11 +92,47 @@ public:
 	static void Init();
 	static void Shutdown();
 
-	static uint32_t Load(const std::string& path, uint32_t size);
+	static uint32_t Load(const std::string& path, uint32_t size, const FontParams& params = {});
 	static Font* Get(uint32_t handle);
 
+	// Devuelve el glifo de un codepoint (o de ShapedGlyph::IndexKey(índice)),
+	// rasterizándolo si aún no está en el atlas
+	static const FTGlyph& GetGlyph(Font* font, uint32_t key);
+
+	// true si glyph es el '?' que GetGlyph devuelve mientras el atlas está lleno
+	static bool IsFallback(Font* font, uint32_t key, const FTGlyph& glyph) {
+		return key != '?' && &glyph == &font->Glyphs['?'];
+	}
+
+	// Marca el inicio de un frame: los glifos usados en el frame actual no se desalojan
+	static void NewFrame();
+
+	static float GetKerning(Font* font, uint32_t left, uint32_t right);
+
+	// Resultado memorizado por (fuente, texto); se calcula con el shaper activo
+	static const ShapedRun& Shape(Font* font, std::string_view text);
+	static void SetShaper(std::unique_ptr<TextShaper> shaper);
+
+	// Carpeta donde se guardan los atlas ya rasterizados ("" desactiva la cache)
+	static void SetCacheDirectory(const std::string& directory);
+
 private:
+	static bool LoadFromCache(const std::string& cachePath, uint64_t fontHash, uint32_t size,
+		const FontParams& params, Font& font);
+	static void WriteCache(const std::string& cachePath, uint64_t fontHash, uint32_t size,
+		const FontParams& params, const Font& font, const std::vector<unsigned char>& atlasBuffer, uint32_t usedRows);
+
+	static void SetupGlyphCache(Font& font, uint32_t usedRows);
+	static bool EnsureFace(Font& font);
+	static void LoadAsciiKerning(Font& font, FT_Face face);
+	static bool RasterizeIntoCell(Font& font, uint32_t key, int32_t cell);
+	static void TouchCell(Font& font, int32_t cell);
+	static void UnlinkCell(Font& font, int32_t cell);
+
 	static FT_Library s_FreeType;
+	static uint64_t s_Frame;
+	static std::unique_ptr<TextShaper> s_Shaper;
 
 	static std::vector<Font> s_Fonts;
-};
\ No newline at end of file
+	static std::string s_CacheDirectory;
+};
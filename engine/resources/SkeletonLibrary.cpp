@@ -0,0 +1,397 @@
+#include "SkeletonLibrary.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <Renderer2D.hpp>
+
+static constexpr float Pi = 3.14159265f;
+static constexpr uint32_t NoSkeleton = 0xFFFFFFFF;
+
+// El esqueleto 0 está vacío y el clip 0 es la pose de reposo de cualquier esqueleto
+std::vector<SkeletonLibrary::Skeleton> SkeletonLibrary::s_Skeletons = { Skeleton{} };
+std::vector<SkeletonLibrary::Bone> SkeletonLibrary::s_Bones;
+std::vector<SkeletonLibrary::Part> SkeletonLibrary::s_Parts;
+std::vector<cass::Vector2<float>> SkeletonLibrary::s_PartVertices;
+std::vector<SkinWeight> SkeletonLibrary::s_PartWeights;
+std::vector<PackedUV> SkeletonLibrary::s_PartUVs;
+
+std::vector<SkeletonLibrary::Clip> SkeletonLibrary::s_Clips = { Clip{ NoSkeleton, 0, 0.0f, true } };
+std::vector<SkeletonLibrary::Track> SkeletonLibrary::s_Tracks;
+std::vector<BoneKeyframe> SkeletonLibrary::s_Keys;
+
+std::vector<Affine2D> SkeletonLibrary::s_Poses;
+std::vector<std::vector<uint32_t>> SkeletonLibrary::s_FreePoses;
+
+std::vector<cass::Vector2<float>> SkeletonLibrary::s_DrawVertices;
+std::vector<cass::Vector2<float>> SkeletonLibrary::s_DrawCorners;
+std::vector<Affine2D> SkeletonLibrary::s_DrawSkin;
+
+Affine2D Affine2D::FromTransform(const BoneTransform& transform)
+{
+	const float c = transform.Rotation != 0.0f ? std::cos(transform.Rotation) : 1.0f;
+	const float s = transform.Rotation != 0.0f ? std::sin(transform.Rotation) : 0.0f;
+
+	return {
+		c * transform.Scale.x, s * transform.Scale.x,
+		-s * transform.Scale.y, c * transform.Scale.y,
+		transform.Position.x, transform.Position.y
+	};
+}
+
+Affine2D Affine2D::Inverse() const
+{
+	float det = A * D - B * C;
+	if (det == 0.0f)
+		return {};
+
+	float inv = 1.0f / det;
+	Affine2D m{ D * inv, -B * inv, -C * inv, A * inv, 0, 0 };
+	m.Tx = -(m.A * Tx + m.C * Ty);
+	m.Ty = -(m.B * Tx + m.D * Ty);
+	return m;
+}
+
+static BoneTransform Lerp(const BoneTransform& a, const BoneTransform& b, float t)
+{
+	// La rotación va por el camino corto
+	float rotation = std::remainder(b.Rotation - a.Rotation, 2.0f * Pi);
+
+	return {
+		a.Position + (b.Position - a.Position) * t,
+		a.Rotation + rotation * t,
+		a.Scale + (b.Scale - a.Scale) * t
+	};
+}
+
+uint32_t SkeletonLibrary::CreateSkeleton(const SkeletonParams& params)
+{
+	Skeleton skeleton;
+	skeleton.FirstBone = (uint32_t)s_Bones.size();
+	skeleton.BoneCount = (uint32_t)params.bones.size();
+	skeleton.FirstPart = (uint32_t)s_Parts.size();
+
+	// Pose de reposo en espacio del esqueleto: los padres van siempre antes que los hijos
+	std::vector<Affine2D> bindWorld(skeleton.BoneCount);
+
+	for (uint32_t i = 0; i < skeleton.BoneCount; i++) {
+		int parent = params.bones[i].parent;
+
+		if (parent >= (int)i) {
+			std::cout << "Skeleton bone " << i << " has parent " << parent << " declared after it\n";
+			parent = -1;
+		}
+
+		Affine2D local = Affine2D::FromTransform(params.bones[i].bind);
+		bindWorld[i] = parent < 0 ? local : bindWorld[parent] * local;
+
+		s_Bones.push_back({ parent, params.bones[i].bind, bindWorld[i].Inverse() });
+	}
+
+	for (const SkeletonPartParams& partParams : params.parts) {
+		if (skeleton.BoneCount == 0) {
+			std::cout << "Skeleton part needs at least one bone\n";
+			break;
+		}
+
+		Part part;
+		part.Bone = partParams.bone < skeleton.BoneCount ? partParams.bone : 0;
+		part.Texture = partParams.texture;
+		part.Argb = partParams.argb;
+		part.Cols = std::max(partParams.cols, 1u);
+		part.Rows = std::max(partParams.rows, 1u);
+		part.FirstVertex = (uint32_t)s_PartVertices.size();
+		part.FirstUV = (uint32_t)s_PartUVs.size();
+
+		uint32_t vertexCount = (part.Cols + 1) * (part.Rows + 1);
+		part.Skinned = !partParams.weights.empty();
+
+		if (part.Skinned && partParams.weights.size() != vertexCount) {
+			std::cout << "Skeleton part expects " << vertexCount << " skin weights, got " << partParams.weights.size() << "\n";
+			part.Skinned = false;
+		}
+
+		// Rígida: vértices en espacio del hueso. Malla: en espacio del esqueleto en reposo.
+		Affine2D offset = Affine2D::FromTransform(partParams.offset);
+		Affine2D toSpace = part.Skinned ? bindWorld[part.Bone] * offset : offset;
+
+		for (uint32_t r = 0; r <= part.Rows; r++) {
+			for (uint32_t c = 0; c <= part.Cols; c++) {
+				cass::Vector2<float> p = {
+					((float)c / part.Cols - partParams.origin.x) * partParams.size.x,
+					((float)r / part.Rows - partParams.origin.y) * partParams.size.y
+				};
+				s_PartVertices.push_back(toSpace.Apply(p));
+
+				SkinWeight weight;
+				if (part.Skinned) {
+					weight = partParams.weights[r * (part.Cols + 1) + c];
+					for (int k = 0; k < 2; k++) {
+						if (weight.bones[k] >= skeleton.BoneCount) {
+							weight.bones[k] = 0;
+							weight.weights[k] = 0;
+						}
+					}
+				}
+				s_PartWeights.push_back(weight);
+			}
+		}
+
+		const cass::Vector4<float>& uv = partParams.uv;
+		for (uint32_t r = 0; r < part.Rows; r++) {
+			for (uint32_t c = 0; c < part.Cols; c++) {
+				float u0 = uv.x + (uv.z - uv.x) * c / part.Cols;
+				float u1 = uv.x + (uv.z - uv.x) * (c + 1) / part.Cols;
+				float v0 = uv.y + (uv.t - uv.y) * r / part.Rows;
+				float v1 = uv.y + (uv.t - uv.y) * (r + 1) / part.Rows;
+				s_PartUVs.push_back(PackedUV::FromUV({ u0, v0, u1, v1 }));
+			}
+		}
+
+		skeleton.Skinned |= part.Skinned;
+		s_Parts.push_back(part);
+	}
+
+	skeleton.PartCount = (uint32_t)s_Parts.size() - skeleton.FirstPart;
+
+	s_Skeletons.push_back(skeleton);
+	return (uint32_t)s_Skeletons.size() - 1;
+}
+
+uint32_t SkeletonLibrary::CreateClip(uint32_t skeleton, const SkeletonClipParams& params)
+{
+	const Skeleton& target = s_Skeletons[skeleton];
+
+	Clip clip;
+	clip.Skeleton = skeleton;
+	clip.FirstTrack = (uint32_t)s_Tracks.size();
+	clip.Duration = params.duration;
+	clip.Loop = params.loop;
+
+	s_Tracks.resize(s_Tracks.size() + target.BoneCount);
+
+	for (const BoneTrackParams& track : params.tracks) {
+		if (track.bone >= target.BoneCount || track.keys.empty())
+			continue;
+
+		Track& entry = s_Tracks[clip.FirstTrack + track.bone];
+		entry.FirstKey = (uint32_t)s_Keys.size();
+		entry.KeyCount = (uint32_t)track.keys.size();
+
+		s_Keys.insert(s_Keys.end(), track.keys.begin(), track.keys.end());
+		std::stable_sort(s_Keys.begin() + entry.FirstKey, s_Keys.end(),
+			[](const BoneKeyframe& a, const BoneKeyframe& b) { return a.time < b.time; });
+
+		if (params.duration <= 0)
+			clip.Duration = std::max(clip.Duration, s_Keys.back().time);
+	}
+
+	s_Clips.push_back(clip);
+	return (uint32_t)s_Clips.size() - 1;
+}
+
+SkeletonAnimator SkeletonLibrary::CreateAnimator(uint32_t skeleton)
+{
+	uint32_t boneCount = s_Skeletons[skeleton].BoneCount;
+
+	SkeletonAnimator animator;
+	animator.Skeleton = skeleton;
+
+	if (boneCount < s_FreePoses.size() && !s_FreePoses[boneCount].empty()) {
+		animator.Pose = s_FreePoses[boneCount].back();
+		s_FreePoses[boneCount].pop_back();
+	}
+	else {
+		animator.Pose = (uint32_t)s_Poses.size();
+		s_Poses.resize(s_Poses.size() + boneCount);
+	}
+
+	UpdatePose(animator, 0.0f);
+	return animator;
+}
+
+void SkeletonLibrary::DestroyAnimator(SkeletonAnimator& animator)
+{
+	uint32_t boneCount = s_Skeletons[animator.Skeleton].BoneCount;
+
+	if (boneCount > 0) {
+		if (boneCount >= s_FreePoses.size())
+			s_FreePoses.resize(boneCount + 1);
+		s_FreePoses[boneCount].push_back(animator.Pose);
+	}
+
+	animator = {};
+}
+
+void SkeletonLibrary::Play(SkeletonAnimator& animator, uint32_t clip, float blendTime)
+{
+	if (animator.Clip == clip)
+		return;
+
+	if (blendTime > 0.0f) {
+		animator.FromClip = animator.Clip;
+		animator.FromTime = animator.Time;
+		animator.Blend = 0.0f;
+		animator.BlendRate = 1.0f / blendTime;
+	}
+	else {
+		animator.Blend = 1.0f;
+	}
+
+	animator.Clip = clip;
+	animator.Time = 0.0f;
+}
+
+BoneTransform SkeletonLibrary::SampleTrack(const Clip& clip, uint32_t bone, float time, const BoneTransform& bind)
+{
+	const Track& track = s_Tracks[clip.FirstTrack + bone];
+	if (track.KeyCount == 0)
+		return bind;
+
+	const BoneKeyframe* first = &s_Keys[track.FirstKey];
+	const BoneKeyframe* last = first + track.KeyCount - 1;
+
+	if (time <= first->time)
+		return first->transform;
+	if (time >= last->time)
+		return last->transform;
+
+	const BoneKeyframe* next = std::upper_bound(first, last, time,
+		[](float t, const BoneKeyframe& key) { return t < key.time; });
+	const BoneKeyframe* prev = next - 1;
+
+	float t = (time - prev->time) / (next->time - prev->time);
+
+	switch (prev->curve) {
+	case Curve::Step:   t = 0.0f; break;
+	case Curve::Smooth: t = t * t * (3.0f - 2.0f * t); break;
+	default: break;
+	}
+
+	return Lerp(prev->transform, next->transform, t);
+}
+
+BoneTransform SkeletonLibrary::Sample(uint32_t skeleton, uint32_t clip, uint32_t bone, float time)
+{
+	const BoneTransform& bind = s_Bones[s_Skeletons[skeleton].FirstBone + bone].Bind;
+	const Clip& data = s_Clips[clip];
+
+	return data.Skeleton == skeleton ? SampleTrack(data, bone, time, bind) : bind;
+}
+
+static float AdvanceTime(float time, float duration, bool loop)
+{
+	if (duration <= 0.0f)
+		return 0.0f;
+
+	if (!loop)
+		return std::min(time, duration);
+
+	time = std::fmod(time, duration);
+	return time < 0.0f ? time + duration : time;
+}
+
+void SkeletonLibrary::UpdatePose(SkeletonAnimator& animator, float deltaTime)
+{
+	const Skeleton& skeleton = s_Skeletons[animator.Skeleton];
+	const Bone* bones = s_Bones.data() + skeleton.FirstBone;
+	Affine2D* world = s_Poses.data() + animator.Pose;
+
+	const Clip& clip = s_Clips[animator.Clip];
+	const Clip& from = s_Clips[animator.FromClip];
+	const bool sampleClip = clip.Skeleton == animator.Skeleton;
+	const bool sampleFrom = from.Skeleton == animator.Skeleton;
+
+	deltaTime *= animator.Speed;
+	animator.Time = AdvanceTime(animator.Time + deltaTime, clip.Duration, clip.Loop);
+
+	float blend = 1.0f;
+	if (animator.Blend < 1.0f) {
+		animator.FromTime = AdvanceTime(animator.FromTime + deltaTime, from.Duration, from.Loop);
+		animator.Blend = std::min(1.0f, animator.Blend + deltaTime * animator.BlendRate);
+		blend = animator.Blend;
+	}
+
+	for (uint32_t i = 0; i < skeleton.BoneCount; i++) {
+		const Bone& bone = bones[i];
+
+		BoneTransform local = sampleClip ? SampleTrack(clip, i, animator.Time, bone.Bind) : bone.Bind;
+
+		if (blend < 1.0f) {
+			BoneTransform previous = sampleFrom ? SampleTrack(from, i, animator.FromTime, bone.Bind) : bone.Bind;
+			local = Lerp(previous, local, blend);
+		}
+
+		Affine2D m = Affine2D::FromTransform(local);
+		world[i] = bone.Parent < 0 ? m : world[bone.Parent] * m;
+	}
+}
+
+void SkeletonLibrary::Update(SkeletonAnimator* animators, uint32_t count, float deltaTime)
+{
+	for (uint32_t i = 0; i < count; i++)
+		UpdatePose(animators[i], deltaTime);
+}
+
+void SkeletonLibrary::Draw(const SkeletonDrawProperties& properties)
+{
+	std::vector<cass::Vector2<float>>& vertices = s_DrawVertices;
+	std::vector<cass::Vector2<float>>& corners = s_DrawCorners;
+	std::vector<Affine2D>& skin = s_DrawSkin;
+
+	const SkeletonAnimator& animator = properties.animator;
+	const Skeleton& skeleton = s_Skeletons[animator.Skeleton];
+	const Affine2D* world = s_Poses.data() + animator.Pose;
+
+	const Affine2D root = Affine2D::FromTransform({ properties.position, properties.angle, properties.scale });
+
+	// Matrices de skinning: del esqueleto en reposo a la pose actual en pantalla
+	if (skeleton.Skinned) {
+		skin.resize(skeleton.BoneCount);
+		for (uint32_t i = 0; i < skeleton.BoneCount; i++)
+			skin[i] = root * world[i] * s_Bones[skeleton.FirstBone + i].InverseBind;
+	}
+
+	for (uint32_t p = 0; p < skeleton.PartCount; p++) {
+		const Part& part = s_Parts[skeleton.FirstPart + p];
+		const uint32_t stride = part.Cols + 1;
+		const uint32_t vertexCount = stride * (part.Rows + 1);
+
+		const cass::Vector2<float>* rest = &s_PartVertices[part.FirstVertex];
+		vertices.resize(vertexCount);
+
+		if (part.Skinned) {
+			const SkinWeight* weights = &s_PartWeights[part.FirstVertex];
+
+			for (uint32_t v = 0; v < vertexCount; v++) {
+				const SkinWeight& w = weights[v];
+				vertices[v] = skin[w.bones[0]].Apply(rest[v]) * w.weights[0];
+				if (w.weights[1] != 0.0f)
+					vertices[v] += skin[w.bones[1]].Apply(rest[v]) * w.weights[1];
+			}
+		}
+		else {
+			Affine2D m = root * world[part.Bone];
+			for (uint32_t v = 0; v < vertexCount; v++)
+				vertices[v] = m.Apply(rest[v]);
+		}
+
+		corners.clear();
+		for (uint32_t r = 0; r < part.Rows; r++) {
+			for (uint32_t c = 0; c < part.Cols; c++) {
+				uint32_t v = r * stride + c;
+				corners.push_back(vertices[v]);               // bottom-left
+				corners.push_back(vertices[v + 1]);           // bottom-right
+				corners.push_back(vertices[v + stride + 1]);  // top-right
+				corners.push_back(vertices[v + stride]);      // top-left
+			}
+		}
+
+		Renderer2D::DrawQuads({
+			.count = part.Cols * part.Rows,
+			.corners = corners.data(),
+			.uvs = &s_PartUVs[part.FirstUV],
+			.texture = part.Texture,
+			.argb = part.Argb
+			});
+	}
+}
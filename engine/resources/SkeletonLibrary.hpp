@@ -0,0 +1,203 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <cass_linear.hpp>
+#include <PackedUV.hpp>
+#include <Texture2D.hpp>
+
+// Transformación local de un hueso respecto a su padre
+struct BoneTransform {
+	cass::Vector2<float> Position = { 0, 0 };
+	float Rotation = 0;                        // radianes
+	cass::Vector2<float> Scale = { 1, 1 };
+};
+
+// Matriz afín 2D: x' = A*x + C*y + Tx, y' = B*x + D*y + Ty
+struct Affine2D {
+	float A = 1, B = 0, C = 0, D = 1;
+	float Tx = 0, Ty = 0;
+
+	static Affine2D FromTransform(const BoneTransform& transform);
+	Affine2D Inverse() const;
+
+	Affine2D operator*(const Affine2D& m) const {
+		return {
+			A * m.A + C * m.B, B * m.A + D * m.B,
+			A * m.C + C * m.D, B * m.C + D * m.D,
+			A * m.Tx + C * m.Ty + Tx, B * m.Tx + D * m.Ty + Ty
+		};
+	}
+
+	cass::Vector2<float> Apply(const cass::Vector2<float>& p) const {
+		return { A * p.x + C * p.y + Tx, B * p.x + D * p.y + Ty };
+	}
+};
+
+struct BoneParams {
+	int parent = -1;             // índice de un hueso anterior; -1 = raíz
+	BoneTransform bind;          // pose de reposo
+};
+
+// Vértice de una malla deformable: hasta dos huesos con pesos que suman 1
+struct SkinWeight {
+	uint16_t bones[2] = { 0, 0 };
+	float weights[2] = { 1, 0 };
+};
+
+// Sprite pegado a un hueso. Las piezas se dibujan en el orden en que se declaran.
+struct SkeletonPartParams {
+	uint32_t bone = 0;
+	Texture2D* texture = nullptr;
+	cass::Vector4<float> uv = { 0, 0, 1, 1 };
+	cass::Vector2<float> size = { 1, 1 };
+	cass::Vector2<float> origin = { 0.5f, 0.5f };
+	BoneTransform offset;        // respecto al hueso
+	uint32_t argb = 0xFFFFFFFF;
+
+	// Malla deformable: el sprite se divide en cols x rows quads y cada vértice
+	// de la rejilla ((cols+1) * (rows+1), por filas desde abajo) sigue a sus
+	// huesos. Sin weights la pieza es rígida y sigue solo a bone.
+	uint32_t cols = 1;
+	uint32_t rows = 1;
+	std::vector<SkinWeight> weights;
+};
+
+struct SkeletonParams {
+	std::vector<BoneParams> bones;
+	std::vector<SkeletonPartParams> parts;
+};
+
+enum class Curve : uint8_t {
+	Linear = 0,
+	Step = 1,
+	Smooth = 2     // entra y sale despacio (smoothstep)
+};
+
+// La curva se aplica en el tramo que va de este keyframe al siguiente
+struct BoneKeyframe {
+	float time = 0;
+	BoneTransform transform;
+	Curve curve = Curve::Linear;
+};
+
+struct BoneTrackParams {
+	uint32_t bone = 0;
+	std::vector<BoneKeyframe> keys;   // ordenados por tiempo
+};
+
+struct SkeletonClipParams {
+	float duration = 0;
+	bool loop = true;
+	std::vector<BoneTrackParams> tracks;   // los huesos sin pista se quedan en su pose de reposo
+};
+
+// Estado por entidad. Las matrices de mundo de sus huesos viven en el buffer
+// de poses de la librería, a partir de Pose.
+struct SkeletonAnimator {
+	uint32_t Skeleton = 0;
+	uint32_t Pose = 0;
+	uint32_t Clip = 0;           // 0 = pose de reposo
+	float Time = 0;
+	float Speed = 1;
+
+	// Mezcla con el clip anterior mientras Blend < 1
+	uint32_t FromClip = 0;
+	float FromTime = 0;
+	float Blend = 1;
+	float BlendRate = 0;
+};
+
+struct SkeletonDrawProperties {
+	const SkeletonAnimator& animator;
+	cass::Vector2<float> position;
+	cass::Vector2<float> scale = { 1, 1 };   // scale.x negativo = mirando a la izquierda
+	float angle = 0.0f;
+};
+
+// Esqueletos y clips compartidos e inmutables, igual que AnimationLibrary con
+// los flipbooks. Update calcula en una pasada la pose de mundo de muchos
+// animators (seguro desde varios hilos mientras nadie cree recursos ni poses)
+// y Draw envía sus piezas a Renderer2D.
+class SkeletonLibrary
+{
+public:
+	static uint32_t CreateSkeleton(const SkeletonParams& params);
+	static uint32_t CreateClip(uint32_t skeleton, const SkeletonClipParams& params);
+
+	// Reserva/libera el espacio de las matrices de mundo de un animator
+	static SkeletonAnimator CreateAnimator(uint32_t skeleton);
+	static void DestroyAnimator(SkeletonAnimator& animator);
+
+	// Cambia de clip; con blendTime > 0 mezcla desde la pose actual
+	static void Play(SkeletonAnimator& animator, uint32_t clip, float blendTime = 0.0f);
+
+	static uint32_t GetBoneCount(uint32_t skeleton) { return (uint32_t)s_Skeletons[skeleton].BoneCount; }
+	// GetBoneCount matrices; con 0 huesos el puntero no apunta a nada válido
+	static const Affine2D* GetWorldTransforms(const SkeletonAnimator& animator) { return s_Poses.data() + animator.Pose; }
+
+	// Muestrea un clip para un hueso (sin mezcla)
+	static BoneTransform Sample(uint32_t skeleton, uint32_t clip, uint32_t bone, float time);
+
+	static void Update(SkeletonAnimator* animators, uint32_t count, float deltaTime);
+	static void Draw(const SkeletonDrawProperties& properties);
+
+private:
+	struct Skeleton {
+		uint32_t FirstBone = 0;
+		uint32_t BoneCount = 0;
+		uint32_t FirstPart = 0;
+		uint32_t PartCount = 0;
+		bool Skinned = false;
+	};
+
+	struct Bone {
+		int Parent;
+		BoneTransform Bind;
+		Affine2D InverseBind;    // de espacio del esqueleto en reposo a espacio del hueso
+	};
+
+	struct Part {
+		uint32_t Bone;
+		Texture2D* Texture;
+		uint32_t Argb;
+		uint32_t Cols, Rows;
+		uint32_t FirstVertex;    // rejilla en espacio del hueso (rígida) o del esqueleto en reposo (malla)
+		uint32_t FirstUV;        // un PackedUV por quad de la rejilla
+		bool Skinned;
+	};
+
+	// Tramo de keyframes de un hueso dentro de un clip
+	struct Track {
+		uint32_t FirstKey = 0;
+		uint32_t KeyCount = 0;
+	};
+
+	struct Clip {
+		uint32_t Skeleton = 0;
+		uint32_t FirstTrack = 0;   // uno por hueso del esqueleto
+		float Duration = 0;
+		bool Loop = true;
+	};
+
+	static BoneTransform SampleTrack(const Clip& clip, uint32_t bone, float time, const BoneTransform& bind);
+	static void UpdatePose(SkeletonAnimator& animator, float deltaTime);
+
+	static std::vector<Skeleton> s_Skeletons;
+	static std::vector<Bone> s_Bones;
+	static std::vector<Part> s_Parts;
+	static std::vector<cass::Vector2<float>> s_PartVertices;
+	static std::vector<SkinWeight> s_PartWeights;
+	static std::vector<PackedUV> s_PartUVs;
+
+	static std::vector<Clip> s_Clips;
+	static std::vector<Track> s_Tracks;
+	static std::vector<BoneKeyframe> s_Keys;
+
+	static std::vector<Affine2D> s_Poses;
+	static std::vector<std::vector<uint32_t>> s_FreePoses;   // por número de huesos
+
+	// Memoria de trabajo de Draw, que corre en el hilo de render
+	static std::vector<cass::Vector2<float>> s_DrawVertices;
+	static std::vector<cass::Vector2<float>> s_DrawCorners;
+	static std::vector<Affine2D> s_DrawSkin;
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+struct Font;
+
+// Un shaper puede devolver glifos que no son un solo carácter (ligaduras de
+// HarfBuzz): esos llevan Codepoint = 0 y se dibujan por GlyphIndex.
+struct ShapedGlyph {
+	uint32_t Codepoint;   // carácter que representa el glifo; 0 = solo GlyphIndex
+	uint32_t GlyphIndex;  // índice del glifo en la fuente; 0 = se busca por Codepoint
+	uint32_t Cluster;     // byte del texto donde empieza lo que cubre el glifo
+	float XOffset;        // ajuste de la pluma antes del glifo (kerning)
+	float YOffset;
+	float XAdvance;       // avance después del glifo
+
+	// Clave de FontManager::GetGlyph: los codepoints nunca llegan al bit alto
+	static constexpr uint32_t IndexKeyFlag = 0x80000000;
+	static uint32_t IndexKey(uint32_t glyphIndex) { return IndexKeyFlag | glyphIndex; }
+
+	uint32_t GlyphKey() const { return Codepoint ? Codepoint : IndexKey(GlyphIndex); }
+};
+
+struct ShapedRun {
+	std::vector<ShapedGlyph> Glyphs;
+	bool Fallback = false;   // algún glifo salió como '?' porque el atlas estaba lleno: no se memoriza
+};
+
+// Convierte texto UTF-8 en una secuencia de glifos posicionados.
+// FontManager memoriza el resultado por (fuente, texto), así que un backend
+// caro (p. ej. HarfBuzz) solo se ejecuta la primera vez que aparece una cadena.
+// El backend marca run.Fallback si usó un '?' temporal (ver FontManager::IsFallback).
+class TextShaper {
+public:
+	virtual ~TextShaper() = default;
+	virtual void Shape(Font* font, std::string_view text, ShapedRun& run) = 0;
+};
+
+// Backend por defecto: avance de FreeType + pares de kerning
+class KerningShaper : public TextShaper {
+public:
+	void Shape(Font* font, std::string_view text, ShapedRun& run) override;
+};
@@ -19,6 +19,14 @@ Texture2D::Texture2D(const std::string& path, const Texture2DParams &params)
     m_Width = width;
     m_Height = height;
 
+    // Se clasifica una vez al cargar
+    bool opaque = true, cutout = true;
+    for (size_t i = 3; i < (size_t)width * height * 4; i += 4) {
+        opaque &= data[i] == 255;
+        cutout &= data[i] == 255 || data[i] == 0;
+    }
+    m_Alpha = opaque ? TextureAlpha::Opaque : (cutout ? TextureAlpha::Cutout : TextureAlpha::Translucent);
+
     glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
     glTextureStorage2D(m_RendererID, 1, GL_RGBA8, m_Width, m_Height);
 
@@ -52,6 +60,7 @@ Texture2D::Texture2D(uint32_t width, uint32_t height, const unsigned char* data)
 {
     m_Width = width;
     m_Height = height;
+    m_DataFormat = GL_RED;
 
     glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
 
@@ -79,6 +88,24 @@ Texture2D::~Texture2D() {
         glDeleteTextures(1, &m_RendererID);
 }
 
+void Texture2D::SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* data)
+{
+    // Las filas de 1 canal no siempre están alineadas a 4 bytes
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glTextureSubImage2D(
+        m_RendererID,
+        0,
+        x, y,
+        width, height,
+        m_DataFormat,
+        GL_UNSIGNED_BYTE,
+        data
+    );
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
 void Texture2D::Bind(uint32_t slot) const {
     glBindTextureUnit(slot, m_RendererID);
 }
@@ -5,6 +5,14 @@
 #include <glad/glad.h>
 
 class Renderer2D; // forward declaration
+class Framebuffer;
+
+// Qué hay en el canal alfa; Renderer2D lo usa para separar lo opaco de lo translúcido
+enum class TextureAlpha : uint8_t {
+    Opaque = 0,        // todo 255
+    Cutout = 1,        // solo 0 o 255: se puede dibujar como opaco descartando los huecos
+    Translucent = 2
+};
 
 struct Texture2DParams
 {
@@ -25,17 +33,25 @@ public:
 
     uint32_t GetWidth() const { return m_Width; }
     uint32_t GetHeight() const { return m_Height; }
+    TextureAlpha GetAlpha() const { return m_Alpha; }
+
+    // Sube solo una región (x, y, w, h) en el formato con el que se creó la textura
+    void SetData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* data);
 
     Texture2D(const Texture2D&) = delete;
     Texture2D& operator=(const Texture2D&) = delete;
 
-private:
     void Bind(uint32_t slot = 0) const;
+
+private:
     Texture2D(uint32_t rendererID, uint32_t width, uint32_t height);
 
     uint32_t m_Width = 0;
     uint32_t m_Height = 0;
     uint32_t m_RendererID = 0;
+    GLenum m_DataFormat = GL_RGBA;
+    TextureAlpha m_Alpha = TextureAlpha::Translucent;
 
     friend class Renderer2D;
+    friend class Framebuffer;
 };
\ No newline at end of file
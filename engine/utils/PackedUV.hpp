@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <cmath>
+#include <cass_linear.hpp>
+
+// Rectángulo UV en 16 bits normalizados (0 = 0.0, 65535 = 1.0), el formato
+// que usa el vértice del Renderer2D. Solo admite UVs dentro de [0, 1]: Pack
+// recorta lo que quede fuera, así que no sirve para texturas en GL_REPEAT.
+// Renderer2D lo comprueba con assert en las llamadas que reciben UVs en float.
+struct PackedUV {
+    uint16_t U0 = 0;
+    uint16_t V0 = 0;
+    uint16_t U1 = 0xFFFF;
+    uint16_t V1 = 0xFFFF;
+
+    static uint16_t Pack(float value)
+    {
+        value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+        return (uint16_t)std::lround(value * 65535.0f);
+    }
+
+    static PackedUV FromUV(const cass::Vector4<float>& uv)
+    {
+        return { Pack(uv.x), Pack(uv.y), Pack(uv.z), Pack(uv.t) };
+    }
+
+    cass::Vector4<float> ToUV() const
+    {
+        const float inv = 1.0f / 65535.0f;
+        return { U0 * inv, V0 * inv, U1 * inv, V1 * inv };
+    }
+};
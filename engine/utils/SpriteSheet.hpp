@@ -1,4 +1,6 @@
 #pragma once
+#include <vector>
+#include <PackedUV.hpp>
 
 struct SpriteSheetParams {
     int textureWidth = 0;
@@ -9,14 +11,16 @@ struct SpriteSheetParams {
     int cols = 0;
     cass::Vector2<int> spacing = { 0, 0 };
     cass::Vector2<int> offset = { 0, 0 };
+    float inset = 0.0f;   // texels recortados en cada borde; 0.5 evita que el filtrado mezcle sprites vecinos
 };
 
+// Los UV de todos los sprites se calculan una vez al construir y se guardan
+// seguidos por índice (row * cols + col), en float y empaquetados en 16 bits.
 class SpriteSheet
 {
 private:
-    cass::Vector2<float> spriteSizeUV{ 0.0f, 0.0f };
-    cass::Vector2<float> spacingUV{ 0.0f, 0.0f };
-    cass::Vector2<float> offsetUV{ 0.0f, 0.0f };
+    std::vector<cass::Vector4<float>> uvs;
+    std::vector<PackedUV> packedUVs;
 public:
 
     int rows = 0;
@@ -30,26 +34,35 @@ public:
         const float invW = 1.0f / params.textureWidth;
         const float invH = 1.0f / params.textureHeight;
 
-        spriteSizeUV = {
-            params.spriteWidth * invW,
-            params.spriteHeight * invH
-        };
+        const float strideX = (params.spriteWidth + params.spacing.x) * invW;
+        const float strideY = (params.spriteHeight + params.spacing.y) * invH;
 
-        spacingUV = {
-            params.spacing.x * invW,
-            params.spacing.y * invH
-        };
+        const float insetX = params.inset * invW;
+        const float insetY = params.inset * invH;
 
-        offsetUV = {
-            params.offset.x * invW,
-            params.offset.y * invH
-        };
-    }
+        uvs.resize((size_t)rows * cols);
+        packedUVs.resize(uvs.size());
+
+        for (int row = 0; row < rows; row++) {
+            for (int col = 0; col < cols; col++) {
+                float u0 = params.offset.x * invW + col * strideX;
+                float v0 = params.offset.y * invH + row * strideY;
+                float u1 = u0 + params.spriteWidth * invW;
+                float v1 = v0 + params.spriteHeight * invH;
 
-    cass::Vector4<float> GetUV(int row, int col) const { 
-        float u0 = offsetUV.x + col * (spriteSizeUV.x + spacingUV.x); 
-        float v0 = offsetUV.y + row * (spriteSizeUV.y + spacingUV.y); 
-        float u1 = u0 + spriteSizeUV.x; float v1 = v0 + spriteSizeUV.y; 
-        return { u0, v0, u1, v1 }; 
+                int index = GetIndex(row, col);
+                uvs[index] = { u0 + insetX, v0 + insetY, u1 - insetX, v1 - insetY };
+                packedUVs[index] = PackedUV::FromUV(uvs[index]);
+            }
+        }
     }
-};
\ No newline at end of file
+
+    int GetIndex(int row, int col) const { return row * cols + col; }
+    int GetCount() const { return (int)uvs.size(); }
+
+    const cass::Vector4<float>& GetUV(int index) const { return uvs[index]; }
+    const cass::Vector4<float>& GetUV(int row, int col) const { return uvs[GetIndex(row, col)]; }
+
+    const PackedUV& GetPackedUV(int index) const { return packedUVs[index]; }
+    const PackedUV& GetPackedUV(int row, int col) const { return packedUVs[GetIndex(row, col)]; }
+};
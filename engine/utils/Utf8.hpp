@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+
+// Decodifica un codepoint UTF-8 y avanza el iterador.
+// Secuencias inválidas devuelven U+FFFD y consumen un byte.
+inline uint32_t DecodeUtf8(const char*& it, const char* end)
+{
+    const uint8_t c = (uint8_t)*it++;
+
+    if (c < 0x80)
+        return c;
+
+    int extra;
+    uint32_t codepoint;
+
+    if ((c & 0xE0) == 0xC0) { extra = 1; codepoint = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { extra = 2; codepoint = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { extra = 3; codepoint = c & 0x07; }
+    else return 0xFFFD;
+
+    if (end - it < extra)
+        return 0xFFFD;
+
+    for (int i = 0; i < extra; i++)
+    {
+        const uint8_t next = (uint8_t)it[i];
+        if ((next & 0xC0) != 0x80)
+            return 0xFFFD;
+        codepoint = (codepoint << 6) | (next & 0x3F);
+    }
+
+    it += extra;
+    return codepoint;
+}